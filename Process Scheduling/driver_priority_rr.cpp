@@ -1,70 +1,132 @@
-/**
- * Driver (main) program for Priority RR scheduling algorithm.
- * The input file is a text file containing the process information in the following format:
- * [name] [priority] [CPU burst]
- */
-
-#include <iostream>
-#include <fstream>
-#include <string>
-#include <vector>
-#include <sstream>
-#include "scheduler_priority_rr.h"
-
-using namespace std;
-
-int main(int argc, char *argv[]) {
-    std::cout << "CS 433 Programming assignment 3" << std::endl;
-    std::cout << "Author: xxxxxx and xxxxxxx" << std::endl;     // TODO: add your name
-    std::cout << "Date: xx/xx/20xx" << std::endl;               // TODO: add date
-    std::cout << "Course: CS433 (Operating Systems)" << std::endl;
-    std::cout << "Description : test Priority RR scheduling algorithm " << std::endl;
-    std::cout << "=================================" << std::endl;
-
-    // Make sure the user has provided the input file name
-    if (argc < 3) {
-        cerr << "Usage: " << argv[0] << " <input_file> <time quantum>" << endl;
-        exit(1);
-    }
-
-    // Read the time quantum if provided.
-    int time_quantume = atoi(argv[2]);
-
-    // Read the input file
-    ifstream input_file(argv[1]);
-    // Make sure the file is open
-    if (!input_file.is_open()) {
-        cerr << "Error: Unable to open file " << argv[1] << endl;
-        exit(1);
-    }
-    string line;
-    vector<PCB> process_list;
-    int id = 0;
-    while(getline(input_file, line)) {
-        // Split the line into tokens
-        istringstream ss(line);
-        string name;
-        // parse out the name
-        getline(ss, name, ',');
-        // parse out the priority
-        string token;
-        getline(ss, token, ',');
-        unsigned int priority = stoi(token);
-        // parse out the burst time
-        getline(ss, token, ',');
-        unsigned int burst_time = stoi(token);
-
-        // Create a PCB object and add it to the process list
-        PCB pcb(name, id, priority, burst_time);
-        id++;
-        pcb.print();
-        process_list.push_back(pcb);
-    }
-
-    // Create a scheduler object
-    SchedulerPriorityRR scheduler (time_quantume);
-    // Run the scheduler
-    scheduler.init(process_list);
-    scheduler.simulate();
-    scheduler.print_results();
+/**
+ * Driver (main) program for Priority RR scheduling algorithm.
+ * The input file is a text file containing the process information in the following format:
+ * [name] [priority] [CPU burst] [arrival time]
+ * The arrival time is optional and defaults to 0.
+ */
+
+#include <iostream>
+#include <fstream>
+#include <string>
+#include <vector>
+#include <sstream>
+#include <chrono>
+#include "scheduler_priority_rr.h"
+
+using namespace std;
+
+int main(int argc, char *argv[]) {
+    std::cout << "CS 433 Programming assignment 3" << std::endl;
+    std::cout << "Author: xxxxxx and xxxxxxx" << std::endl;     // TODO: add your name
+    std::cout << "Date: xx/xx/20xx" << std::endl;               // TODO: add date
+    std::cout << "Course: CS433 (Operating Systems)" << std::endl;
+    std::cout << "Description : test Priority RR scheduling algorithm " << std::endl;
+    std::cout << "=================================" << std::endl;
+
+    // Make sure the user has provided the input file name
+    if (argc < 3) {
+        cerr << "Usage: " << argv[0] << " <input_file> <time quantum> [--silent | --trace <file>] [--csv <file>] [--binary <file>] [--time]" << endl;
+        exit(1);
+    }
+
+    // Read the time quantum if provided.
+    int time_quantume = atoi(argv[2]);
+
+    // Read the options.
+    TraceMode trace_mode = TraceMode::TEXT;
+    const char *trace_file = nullptr;
+    const char *csv_file = nullptr;
+    const char *binary_file = nullptr;
+    bool timed = false;
+    for (int i = 3; i < argc; i++) {
+        string option = argv[i];
+        if (option == "--time") {
+            timed = true;
+        } else if (option == "--silent") {
+            trace_mode = TraceMode::SILENT;
+        } else if (option == "--trace" && i + 1 < argc) {
+            trace_mode = TraceMode::BINARY;
+            trace_file = argv[++i];
+        } else if (option == "--csv" && i + 1 < argc) {
+            csv_file = argv[++i];
+        } else if (option == "--binary" && i + 1 < argc) {
+            binary_file = argv[++i];
+        } else {
+            cerr << "Error: Unknown option " << option << endl;
+            exit(1);
+        }
+    }
+
+    // Read the input file
+    ifstream input_file(argv[1]);
+    // Make sure the file is open
+    if (!input_file.is_open()) {
+        cerr << "Error: Unable to open file " << argv[1] << endl;
+        exit(1);
+    }
+    string line;
+    vector<PCB> process_list;
+    int id = 0;
+    while(getline(input_file, line)) {
+        // Split the line into tokens
+        istringstream ss(line);
+        string name;
+        // parse out the name
+        getline(ss, name, ',');
+        // parse out the priority
+        string token;
+        getline(ss, token, ',');
+        unsigned int priority = stoi(token);
+        // parse out the burst time
+        getline(ss, token, ',');
+        unsigned int burst_time = stoi(token);
+        // parse out the arrival time, if there is one
+        unsigned int arrival_time = 0;
+        if (getline(ss, token, ',') && token.find_first_of("0123456789") != string::npos)
+            arrival_time = stoi(token);
+
+        // Create a PCB object and add it to the process list
+        PCB pcb(name, id, priority, burst_time, arrival_time);
+        id++;
+        pcb.print();
+        process_list.push_back(pcb);
+    }
+
+    // Create a scheduler object
+    SchedulerPriorityRR scheduler (time_quantume);
+    if (!scheduler.setTraceMode(trace_mode, trace_file)) {
+        cerr << "Error: Unable to write file " << trace_file << endl;
+        exit(1);
+    }
+    // Run the scheduler, timing the simulation and the printing of the
+    // results apart.
+    scheduler.init(process_list);
+    auto start = chrono::steady_clock::now();
+    scheduler.simulate();
+    auto simulated = chrono::steady_clock::now();
+    scheduler.print_results();
+    auto printed = chrono::steady_clock::now();
+
+    // Export the statistics of each process if asked to.
+    if (csv_file != nullptr && !scheduler.exportStats(csv_file, StatsFormat::CSV)) {
+        cerr << "Error: Unable to write file " << csv_file << endl;
+        exit(1);
+    }
+    if (binary_file != nullptr && !scheduler.exportStats(binary_file, StatsFormat::BINARY)) {
+        cerr << "Error: Unable to write file " << binary_file << endl;
+        exit(1);
+    }
+
+    // Report where the time went. Writing the trace is counted as output,
+    // not as simulation.
+    if (timed) {
+        double trace_seconds = scheduler.traceWriteSeconds();
+        double simulate_seconds = chrono::duration<double>(simulated - start).count() - trace_seconds;
+        cerr << "Simulation: " << simulate_seconds << " s for " << scheduler.getTurnsRun() << " turns";
+        if (simulate_seconds > 0)
+            cerr << " (" << scheduler.getTurnsRun() / simulate_seconds << " turns/s)";
+        cerr << endl;
+        cerr << "Trace output: " << trace_seconds << " s" << endl;
+        cerr << "Results output: " << chrono::duration<double>(printed - simulated).count() << " s" << endl;
+    }
 }
\ No newline at end of file
@@ -0,0 +1,111 @@
+/**
+ * Assignment 3: CPU Scheduler
+ * @file event_queue.h
+ * @author Corey Talbert
+ * @brief EventQueue is the time-ordered queue of simulation events that
+ * drives Scheduler::simulate: process arrivals, quantum expiries and
+ * completions.
+ * @version 0.1
+ * @date 11/4/2022
+ */
+
+#pragma once
+#include <algorithm>
+#include <vector>
+#include "pcb.h"
+
+/**
+ * @brief The kinds of simulation event. At the same time, arrivals are
+ * handled before the end of the running process's turn, so a process that
+ * arrives just as another's quantum expires is queued ahead of it.
+ */
+enum class EventKind { ARRIVAL , QUANTUM_EXPIRY , COMPLETION } ;
+
+/**
+ * @brief Something that happens to a process at a point in time.
+ */
+struct Event
+{
+    // The time of the event.
+    unsigned time = 0 ;
+    // What happens.
+    EventKind kind = EventKind::ARRIVAL ;
+    // The turn a quantum expiry or completion belongs to. A turn that was cut
+    // short leaves its old event behind with a stale turn number.
+    unsigned long turn = 0 ;
+    // The order the event was pushed in, which breaks the remaining ties.
+    unsigned long seq = 0 ;
+    // The process the event happens to.
+    PCB * pcb = nullptr ;
+} ;
+
+/**
+ * @brief A binary min-heap of events ordered by time, then kind, then the
+ * order they were pushed in.
+ */
+class EventQueue
+{
+private:
+    // The heap of events.
+    std::vector<Event> heap ;
+    // The sequence number of the next event pushed.
+    unsigned long next_seq = 0 ;
+
+    /**
+     * @brief The heap order: true if a comes out after b.
+     */
+    static bool after( const Event & a , const Event & b )
+    {
+        if ( a.time != b.time )
+            return a.time > b.time ;
+        if ( a.kind != b.kind )
+            return a.kind > b.kind ;
+        return a.seq > b.seq ;
+    }
+
+public:
+    /**
+     * @brief Indicates if there are no events.
+     * @return True if the queue is empty, otherwise false.
+     */
+    bool isEmpty() const { return this->heap.empty() ; }
+
+    /**
+     * @brief Adds an event.
+     * @param time The time of the event.
+     * @param kind What happens.
+     * @param pcb The process it happens to.
+     * @param turn The turn the event belongs to, for quantum expiries and
+     * completions.
+     */
+    void push( const unsigned & time , const EventKind & kind , PCB * pcb ,
+               const unsigned long & turn = 0 )
+    {
+        Event event ;
+        event.time = time ;
+        event.kind = kind ;
+        event.turn = turn ;
+        event.seq = this->next_seq ++ ;
+        event.pcb = pcb ;
+        this->heap.push_back( event ) ;
+        std::push_heap( this->heap.begin() , this->heap.end() , after ) ;
+    }
+
+    /**
+     * @brief Gives the earliest event without removing it.
+     * @return The earliest event. The queue must not be empty.
+     */
+    const Event & top() const { return this->heap.front() ; }
+
+    /**
+     * @brief Removes the earliest event.
+     * @return The earliest event. The queue must not be empty.
+     */
+    Event pop()
+    {
+        std::pop_heap( this->heap.begin() , this->heap.end() , after ) ;
+        Event event = this->heap.back() ;
+        this->heap.pop_back() ;
+        return event ;
+    }
+} ;
@@ -0,0 +1,69 @@
+/**
+ * Assignment 3: CPU Scheduler
+ * @file process_order.h
+ * @author Corey Talbert
+ * @brief Ordering a process list by a 32-bit key without moving any PCBs.
+ * The schedulers that run processes in key order sort (key, index) pairs
+ * with an LSD radix sort and keep the resulting permutation of indexes.
+ * @version 0.1
+ * @date 11/4/2022
+ */
+
+#pragma once
+#include <cstdint>
+#include <vector>
+#include "pcb.h"
+
+/**
+ * @brief Sorts (key, index) pairs, each packed as key << 32 | index, by key
+ * with an LSD radix sort: one pass per byte of the key, lowest byte first.
+ * Every pass is stable, so pairs with equal keys keep the order they were
+ * given in. A pass in which every pair has the same byte is skipped, so
+ * small keys cost one or two passes.
+ * @param pairs The pairs. Sorted in place.
+ */
+inline void radixSort( std::vector<uint64_t> & pairs )
+{
+    std::vector<uint64_t> buffer( pairs.size() ) ;
+    for ( unsigned shift = 32 ; shift < 64 ; shift += 8 )
+    {
+        // Count the pairs per byte value, then turn the counts into the
+        // position the first pair of each value goes to.
+        unsigned count[ 256 ] = { 0 } ;
+        for ( uint64_t pair : pairs )
+            ++ count[ ( pair >> shift ) & 0xFF ] ;
+        if ( count[ ( pairs.empty() ? 0 : pairs[ 0 ] >> shift ) & 0xFF ] == pairs.size() )
+            continue ;
+        unsigned position = 0 ;
+        for ( unsigned & c : count )
+        {
+            unsigned size = c ;
+            c = position ;
+            position += size ;
+        }
+        for ( uint64_t pair : pairs )
+            buffer[ count[ ( pair >> shift ) & 0xFF ] ++ ] = pair ;
+        pairs.swap( buffer ) ;
+    }
+}
+
+/**
+ * @brief Gives the indexes of a process list in ascending order of a key,
+ * with equal keys in list order.
+ * @param list The processes.
+ * @param key Called as key( pcb ) for each process, giving a 32-bit key.
+ * @return The permutation: the index of the first process in key order,
+ * then the second, and so on.
+ */
+template <class Key>
+std::vector<unsigned> sortedOrder( const std::vector<PCB> & list , Key key )
+{
+    std::vector<uint64_t> pairs( list.size() ) ;
+    for ( unsigned i = 0 ; i < list.size() ; ++i )
+        pairs[ i ] = ( ( uint64_t ) key( list[ i ] ) << 32 ) | i ;
+    radixSort( pairs ) ;
+    std::vector<unsigned> order( list.size() ) ;
+    for ( unsigned i = 0 ; i < list.size() ; ++i )
+        order[ i ] = pairs[ i ] & 0xFFFFFFFF ;
+    return order ;
+}
@@ -0,0 +1,199 @@
+/**
+ * Assignment 3: CPU Scheduler
+ * @file process_stats.h
+ * @author Corey Talbert
+ * @brief ProcessStats holds the results of the processes a scheduler has
+ * completed as numeric columns, one row per process in completion order.
+ * Nothing is formatted while the simulation runs: the rows are turned into
+ * text, CSV or a binary file only when they are asked for.
+ * @version 0.1
+ * @date 11/4/2022
+ */
+
+#pragma once
+#include <algorithm>
+#include <cstdint>
+#include <cstdio>
+#include <future>
+#include <string>
+#include <vector>
+#include "pcb.h"
+
+// The longest line of text printed for one process, with its terminator.
+const unsigned MAX_LINE = 80 ;
+
+/**
+ * @brief The file formats ProcessStats can export.
+ */
+enum class StatsFormat { CSV , BINARY } ;
+
+static_assert( sizeof( unsigned ) == 4 , "the binary stats format stores unsigned columns as is" ) ;
+
+/**
+ * @brief The per-process results of a simulation, as columns.
+ */
+class ProcessStats
+{
+public:
+    // The index in the process list of the process of each row.
+    std::vector<unsigned> id ;
+    // The time each process completed.
+    std::vector<unsigned> completion ;
+    // The time each process spent waiting in the ready queue.
+    std::vector<unsigned> waiting ;
+    // The time from each process's arrival to its completion.
+    std::vector<unsigned> turnaround ;
+    // The time from each process's arrival to its first turn on the CPU.
+    std::vector<unsigned> response ;
+
+    /**
+     * @brief Gives the number of rows.
+     * @return The number of processes recorded.
+     */
+    unsigned size() const { return this->id.size() ; }
+
+    /**
+     * @brief Removes every row.
+     */
+    void clear()
+    {
+        this->id.clear() ;
+        this->completion.clear() ;
+        this->waiting.clear() ;
+        this->turnaround.clear() ;
+        this->response.clear() ;
+    }
+
+    /**
+     * @brief Makes room for n rows, so recording them does not reallocate.
+     * @param n The number of rows.
+     */
+    void reserve( const unsigned & n )
+    {
+        this->id.reserve( n ) ;
+        this->completion.reserve( n ) ;
+        this->waiting.reserve( n ) ;
+        this->turnaround.reserve( n ) ;
+        this->response.reserve( n ) ;
+    }
+
+    /**
+     * @brief Adds the row of a process that has just completed.
+     * @param id The index of the process in the process list.
+     * @param pcb The process, with its waiting, turnaround and response
+     * times set.
+     * @param completion The time it completed.
+     */
+    void record( const unsigned & id , const PCB & pcb , const unsigned & completion )
+    {
+        this->id.push_back( id ) ;
+        this->completion.push_back( completion ) ;
+        this->waiting.push_back( pcb.waiting_time ) ;
+        this->turnaround.push_back( pcb.turnaround_time ) ;
+        this->response.push_back( pcb.response_time ) ;
+    }
+
+    /**
+     * @brief Formats rows as the lines print_results shows, one per process,
+     * and appends them to a string. Each line is cut to MAX_LINE - 1
+     * characters, as the lines always were.
+     * @param process_list The process list the ids index, for the names.
+     * @param begin The first row.
+     * @param end One past the last row.
+     * @param out The string the lines are appended to.
+     */
+    void formatText( const std::vector<PCB> & process_list , const unsigned & begin ,
+                     const unsigned & end , std::string & out ) const
+    {
+        char line[ MAX_LINE ] ;
+        for ( unsigned row = begin ; row < end ; ++row )
+        {
+            int length = snprintf( line , MAX_LINE , "%s turn-around time = %u, waiting time = %u" ,
+                process_list[ this->id[ row ] ].name.c_str() , this->turnaround[ row ] ,
+                this->waiting[ row ] ) ;
+            if ( length < 0 )
+                continue ;
+            out.append( line , std::min( ( unsigned ) length , MAX_LINE - 1 ) ) ;
+            out.push_back( '\n' ) ;
+        }
+    }
+
+    /**
+     * @brief Formats rows as text on another thread.
+     * @param process_list The process list the ids index. It and the rows
+     * must not change until the result has been taken.
+     * @param begin The first row.
+     * @param end One past the last row.
+     * @return The lines, once they are ready.
+     */
+    std::future<std::string> formatTextAsync( const std::vector<PCB> & process_list ,
+                                              const unsigned & begin ,
+                                              const unsigned & end ) const
+    {
+        return std::async( std::launch::async , [ this , &process_list , begin , end ] ()
+        {
+            std::string out ;
+            out.reserve( ( end - begin ) * 48 ) ;
+            this->formatText( process_list , begin , end , out ) ;
+            return out ;
+        } ) ;
+    }
+
+    /**
+     * @brief Writes the rows to a file.
+     * @param path The file name.
+     * @param process_list The process list the ids index, for the names.
+     * @param format CSV writes a header line, then one line per row of
+     * name, id, completion, waiting, turnaround and response. BINARY writes
+     * the 4-byte magic number "PST1", a 4-byte row count and then each
+     * column in turn as 4-byte values, in the order above without the name,
+     * all in host byte order.
+     * @return True if the whole file was written, otherwise false.
+     */
+    bool write( const char * path , const std::vector<PCB> & process_list ,
+                const StatsFormat & format ) const
+    {
+        FILE * file = fopen( path , format == StatsFormat::CSV ? "w" : "wb" ) ;
+        if ( file == nullptr )
+            return false ;
+        bool ok = format == StatsFormat::CSV
+            ? this->writeCSV( file , process_list )
+            : this->writeBinary( file ) ;
+        return fclose( file ) == 0 and ok ;
+    }
+
+private:
+    /**
+     * @brief Writes the rows as CSV.
+     * @param file The open file.
+     * @param process_list The process list the ids index.
+     * @return True if every line was written.
+     */
+    bool writeCSV( FILE * file , const std::vector<PCB> & process_list ) const
+    {
+        bool ok = fputs( "name,id,completion,waiting,turnaround,response\n" , file ) >= 0 ;
+        for ( unsigned row = 0 ; ok and row < this->size() ; ++row )
+            ok = fprintf( file , "%s,%u,%u,%u,%u,%u\n" ,
+                process_list[ this->id[ row ] ].name.c_str() , this->id[ row ] ,
+                this->completion[ row ] , this->waiting[ row ] , this->turnaround[ row ] ,
+                this->response[ row ] ) >= 0 ;
+        return ok ;
+    }
+
+    /**
+     * @brief Writes the rows in the binary format.
+     * @param file The open file.
+     * @return True if everything was written.
+     */
+    bool writeBinary( FILE * file ) const
+    {
+        uint32_t count = this->size() ;
+        bool ok = fwrite( "PST1" , 4 , 1 , file ) == 1
+            and fwrite( &count , sizeof( count ) , 1 , file ) == 1 ;
+        for ( const std::vector<unsigned> * column :
+              { &this->id , &this->completion , &this->waiting , &this->turnaround , &this->response } )
+            ok = ok and ( count == 0
+                          or fwrite( column->data() , sizeof( unsigned ) , count , file ) == count ) ;
+        return ok ;
+    }
+} ;
@@ -1,167 +1,386 @@
-/**
-* Assignment 3: CPU Scheduler
- * @file scheduler.h
- * @author Corey Talbert
- * @brief This is the header file for the base Scheduler class. Specific schedulers, e.g. FCFS, SJF and RR, inherit
- *        this base class.
- * @version 0.1
- * @date 11/4/2022
- */
-#pragma once
-#include <cstring>
-#include <vector>
-#include "pcb.h"
-
-const unsigned MAX_LINE = 80 ;
-
-/**
- * @brief This is the base class for the scheduler.
- */
-class Scheduler
-{
-protected:
-    // An array of c-strings of timing statistics for each process run by the scheduler.
-    char ** stats = nullptr ;
-    // The index of the next empty char array in member stats.
-    unsigned stats_index = 0 ;
-    // The sum of all completed processes' turnaround times.
-    unsigned int aggregate_turnaround_time = 0 ;
-    // The average time for a process to complete.
-    float average_turnaround_time = 0 ;
-    // The cumulative time of all processes spent waiting.
-    unsigned int aggregate_waiting_time = 0 ;
-    // The average time a process spends waiting.
-    float average_waiting_time = 0 ;
-    // The total elapsed time spent by the CPU running processes.
-    unsigned int elapsed_time = 0 ;
-    // The total number of processes that have finished.
-    unsigned int processes_completed = 0 ;
-    // The table of processes.
-    std::vector<PCB> process_list ;
-
-    /**
-     * @brief Construct a new Scheduler object
-     */
-    Scheduler() {}
-
-    /**
-     * @brief Destroy the Scheduler object
-     */
-    virtual ~Scheduler()
-    {
-        this->clearSchedulerStats() ;
-    }
-
-    /**
-     * @brief Erase the scheduler statistics stored in member variable stats.
-     */
-    void clearSchedulerStats()
-    {
-        if ( this->stats != nullptr )
-        {
-            // Each c-string is deleted.
-            for ( unsigned i = 0 ; i < this->stats_index ; ++i )
-                if ( stats[ i ] != nullptr )
-                    delete stats[ i ] ;
-            // The array space is deallocated.
-            delete[] stats ;
-        }
-    }
-
-    /**
-     * @brief Saves information about the given PCB pointed to by current_task
-     * to the member string array stats. Meant to be used upon process
-     * completion.
-     * @param current_task The task whose information is stored.
-     */
-    void saveStats( PCB * current_task )
-    {
-        // Clear the string at the current index, if any. This shouldn't happen.
-        if ( this->stats[ stats_index ] != nullptr )
-            delete[] this->stats[ stats_index ] ;
-        this->stats[ stats_index ] = new char[ MAX_LINE ] ;
-        // Zero the line.
-        memset( this->stats[ stats_index ] , 0 , MAX_LINE ) ;
-        // Save the process's name, turnaround time, and waiting time.
-        snprintf( this->stats[ stats_index ] , MAX_LINE , "%s turn-around time = %u, waiting time = %u" ,
-            current_task->name.c_str() , current_task->turnaround_time , current_task->waiting_time ) ;
-        // stats_index is updated to indicate the next empty slot in array stats.
-        ++ stats_index ;
-    }
-
-    /**
-     * @brief Increases the scheduler's elapsed_time member variable by n.
-     * @param n The amount to increase elapsed_time.
-     */
-    void increaseElapsedTime( const unsigned & n )
-    {
-        this->elapsed_time += n ;
-    }
-
-    /**
-     * @brief Increases the scheduler's aggregate_turnaround_time member
-     * variable by n.
-     * @param n The amount to increase aggregate_turnaround_time.
-     */
-    void increaseAggregateTurnaroundTime( const unsigned & n )
-    {
-        this->aggregate_turnaround_time += n ;
-        if ( this->processes_completed != 0 )
-            average_turnaround_time = ( float ) this->aggregate_turnaround_time / this->processes_completed ;
-    }
-
-    /**
-     * @brief Increases the scheduler's aggregate_waiting_time member variable
-     * by n.
-     * @param n The amount to increase aggregate_waiting_time.
-     */
-    void increaseAggregateWaitingTime( const unsigned & n )
-    {
-        this->aggregate_waiting_time += n ;
-        if ( this->processes_completed != 0 )
-            average_waiting_time = ( float ) this->aggregate_waiting_time / this->processes_completed ;
-    }
-
-    /**
-     * @brief Increases the scheduler's count of completed processes by one.
-     */
-    void incrementProcessesCompleted()
-    {
-        ++ this->processes_completed ;
-        if ( this->processes_completed != 0 )
-        {
-            average_turnaround_time = ( float ) this->aggregate_turnaround_time / this->processes_completed ;
-            average_waiting_time = ( float ) this->aggregate_waiting_time / this->processes_completed ;
-        }
-    }
-
-public:
-    /**
-     * @brief This function is called once before the simulation starts. It is
-     * used to initialize the scheduler.
-     * @param process_list The list of processes in the simulation.
-     */
-    virtual void init( std::vector<PCB> & process_list ) = 0 ;
-
-    /**
-     * @brief This function simulates the scheduling of processes in the ready
-     * queue. It stops when all processes are finished.
-     */
-    virtual void simulate() = 0 ;
-
-    /**
-     * @brief This function is called once after the simulation ends. It is used
-     * to print out the results of the simulation.
-     */
-    void print_results()
-    {
-        for ( unsigned i = 0 ; i < this->stats_index ; ++i )
-            ( this->stats[ i ] != nullptr )
-                ? puts( this->stats[ i ] )
-                : printf( "No statistics available for process %u.\n" , i ) ;
-
-        printf( "Average turn-around time = %.6g, Average waiting time = %.6g\n" ,
-            this->average_turnaround_time , this->average_waiting_time ) ;
-    }
-
+/**
+* Assignment 3: CPU Scheduler
+ * @file scheduler.h
+ * @author Corey Talbert
+ * @brief This is the header file for the base Scheduler class. Specific schedulers, e.g. FCFS, SJF and RR, inherit
+ *        this base class. The base class runs the simulation as a discrete
+ *        event loop; the schedulers plug in their ready queues and policies.
+ * @version 0.1
+ * @date 11/4/2022
+ */
+#pragma once
+#include <algorithm>
+#include <cstring>
+#include <numeric>
+#include <vector>
+#include "event_queue.h"
+#include "pcb.h"
+#include "process_stats.h"
+#include "trace_log.h"
+
+/**
+ * @brief This is the base class for the scheduler.
+ */
+class Scheduler
+{
+protected:
+    // The timing statistics of each process run by the scheduler, in the
+    // order they completed.
+    ProcessStats stats ;
+    // The sum of all completed processes' turnaround times.
+    unsigned int aggregate_turnaround_time = 0 ;
+    // The average time for a process to complete.
+    float average_turnaround_time = 0 ;
+    // The cumulative time of all processes spent waiting.
+    unsigned int aggregate_waiting_time = 0 ;
+    // The average time a process spends waiting.
+    float average_waiting_time = 0 ;
+    // The total elapsed time spent by the CPU running processes.
+    unsigned int elapsed_time = 0 ;
+    // The total number of processes that have finished.
+    unsigned int processes_completed = 0 ;
+    // The table of processes.
+    std::vector<PCB> process_list ;
+    // The record of each turn a process gets on the CPU.
+    TraceLog trace ;
+    // The number of turns run so far.
+    unsigned long turns_run = 0 ;
+
+    /**
+     * @brief Construct a new Scheduler object
+     */
+    Scheduler() {}
+
+    /**
+     * @brief Destroy the Scheduler object
+     */
+    virtual ~Scheduler() {}
+
+    /**
+     * @brief Erase the scheduler statistics stored in member variable stats,
+     * and make room for the statistics of n processes.
+     * @param n The number of processes about to be simulated.
+     */
+    void clearSchedulerStats( const unsigned & n = 0 )
+    {
+        this->stats.clear() ;
+        this->stats.reserve( n ) ;
+        this->turns_run = 0 ;
+    }
+
+    /**
+     * @brief Saves information about the given PCB pointed to by current_task
+     * to the member stats. Meant to be used upon process completion. The
+     * numbers are only formatted when the results are printed or exported.
+     * @param current_task The task whose information is stored.
+     */
+    void saveStats( PCB * current_task )
+    {
+        this->stats.record( current_task - this->process_list.data() , *current_task ,
+                            this->elapsed_time ) ;
+    }
+
+    /**
+     * @brief Increases the scheduler's elapsed_time member variable by n.
+     * @param n The amount to increase elapsed_time.
+     */
+    void increaseElapsedTime( const unsigned & n )
+    {
+        this->elapsed_time += n ;
+    }
+
+    /**
+     * @brief Increases the scheduler's aggregate_turnaround_time member
+     * variable by n.
+     * @param n The amount to increase aggregate_turnaround_time.
+     */
+    void increaseAggregateTurnaroundTime( const unsigned & n )
+    {
+        this->aggregate_turnaround_time += n ;
+        if ( this->processes_completed != 0 )
+            average_turnaround_time = ( float ) this->aggregate_turnaround_time / this->processes_completed ;
+    }
+
+    /**
+     * @brief Increases the scheduler's aggregate_waiting_time member variable
+     * by n.
+     * @param n The amount to increase aggregate_waiting_time.
+     */
+    void increaseAggregateWaitingTime( const unsigned & n )
+    {
+        this->aggregate_waiting_time += n ;
+        if ( this->processes_completed != 0 )
+            average_waiting_time = ( float ) this->aggregate_waiting_time / this->processes_completed ;
+    }
+
+    /**
+     * @brief Adds a process to the ready queue. Called when the process
+     * arrives, and when its turn on the CPU ends before it is complete.
+     * @param pcb The process.
+     */
+    virtual void addReady( PCB * pcb ) = 0 ;
+
+    /**
+     * @brief Removes the process to run next from the ready queue.
+     * @return The process, or nullptr if the ready queue is empty.
+     */
+    virtual PCB * nextReady() = 0 ;
+
+    /**
+     * @brief Gives how long a process just taken from the ready queue may
+     * run. By default it runs to completion.
+     * @param pcb The process.
+     * @return The length of its turn.
+     */
+    virtual unsigned turnLength( PCB * pcb )
+    {
+        return pcb->burst_time - pcb->running_time ;
+    }
+
+    /**
+     * @brief Decides whether a process that has just arrived cuts short the
+     * turn of the running process. By default it never does.
+     * @param arriving The process that arrived, already in the ready queue.
+     * @param running The running process.
+     * @param started The time the running turn started.
+     * @param end The time the running turn is due to end.
+     * @return The time the running turn ends, no later than end and no
+     * earlier than the current time.
+     */
+    virtual unsigned preemptAt( const PCB * /* arriving */ , const PCB * /* running */ ,
+                                const unsigned & /* started */ , const unsigned & end )
+    {
+        return end ;
+    }
+
+    /**
+     * @brief Records the statistics of a process that has just completed.
+     * @param pcb The process.
+     */
+    void complete( PCB * pcb )
+    {
+        // The turnaround time runs from the process's arrival to now, and
+        // the process was waiting whenever it wasn't running.
+        pcb->turnaround_time = this->elapsed_time - pcb->arrival_time ;
+        pcb->waiting_time = pcb->turnaround_time - pcb->running_time ;
+        // The process's total wait time is added to the scheduler's total of
+        // cumulative process waiting time.
+        this->increaseAggregateWaitingTime( pcb->waiting_time ) ;
+        // The scheduler tracks the cumulative turnaround times of all
+        // processes to determine the overall average.
+        this->increaseAggregateTurnaroundTime( pcb->turnaround_time ) ;
+        // The scheduler's counter of finished processes is updated. It's used
+        // to calculate average turnaround and waiting times.
+        this->incrementProcessesCompleted() ;
+        // The final process stats are stored to an array held by the scheduler.
+        this->saveStats( pcb ) ;
+    }
+
+    /**
+     * @brief Ends the turn of the running process at the current time. The
+     * process is complete or goes back in the ready queue.
+     * @param pcb The running process.
+     * @param turn_time How long it ran.
+     */
+    void endTurn( PCB * pcb , const unsigned & turn_time )
+    {
+        this->trace.turn( *pcb , pcb - this->process_list.data() , this->elapsed_time - turn_time , turn_time ) ;
+        ++ this->turns_run ;
+        pcb->running_time += turn_time ;
+        if ( pcb->running_time >= pcb->burst_time )
+            this->complete( pcb ) ;
+        else
+            this->addReady( pcb ) ;
+    }
+
+    /**
+     * @brief Increases the scheduler's count of completed processes by one.
+     */
+    void incrementProcessesCompleted()
+    {
+        ++ this->processes_completed ;
+        if ( this->processes_completed != 0 )
+        {
+            average_turnaround_time = ( float ) this->aggregate_turnaround_time / this->processes_completed ;
+            average_waiting_time = ( float ) this->aggregate_waiting_time / this->processes_completed ;
+        }
+    }
+
+public:
+    /**
+     * @brief This function is called once before the simulation starts. It is
+     * used to initialize the scheduler.
+     * @param process_list The list of processes in the simulation.
+     */
+    virtual void init( std::vector<PCB> & process_list ) = 0 ;
+
+    /**
+     * @brief This function simulates the scheduling of processes in the ready
+     * queue. It stops when all processes are finished. The simulation jumps
+     * from event to event: arrivals, quantum expiries and completions. The
+     * CPU is given to the next ready process once every event of the current
+     * time has been handled, and sits idle while nothing is ready.
+     */
+    virtual void simulate()
+    {
+        unsigned n = this->process_list.size() ;
+        // The processes arrive in input order, stably sorted by arrival time
+        // if they are not already in order. Only the next arrival waits in
+        // the event queue, which therefore stays small.
+        std::vector<unsigned> arrivals( n ) ;
+        std::iota( arrivals.begin() , arrivals.end() , 0 ) ;
+        auto earlier = [ this ] ( const unsigned & a , const unsigned & b )
+            { return this->process_list[ a ].arrival_time < this->process_list[ b ].arrival_time ; } ;
+        if ( not std::is_sorted( arrivals.begin() , arrivals.end() , earlier ) )
+            std::stable_sort( arrivals.begin() , arrivals.end() , earlier ) ;
+        unsigned next_arrival = 0 ;
+
+        EventQueue events ;
+        if ( n > 0 )
+            events.push( this->process_list[ arrivals[ 0 ] ].arrival_time , EventKind::ARRIVAL ,
+                         &this->process_list[ arrivals[ 0 ] ] ) ;
+        // The running process, when its turn started and is due to end, and
+        // the number of the turn. Events of earlier turns are stale.
+        PCB * running = nullptr ;
+        unsigned started = 0 ;
+        unsigned turn_end = 0 ;
+        unsigned long turn = 0 ;
+
+        while ( not events.isEmpty() )
+        {
+            Event event = events.pop() ;
+            if ( event.kind != EventKind::ARRIVAL and event.turn != turn )
+                continue ;
+            this->elapsed_time = event.time ;
+            if ( event.kind == EventKind::ARRIVAL )
+            {
+                if ( ++ next_arrival < n )
+                {
+                    PCB * pcb = &this->process_list[ arrivals[ next_arrival ] ] ;
+                    events.push( pcb->arrival_time , EventKind::ARRIVAL , pcb ) ;
+                }
+                this->addReady( event.pcb ) ;
+                // The new arrival may cut the running turn short. The turn
+                // then ends early as if its quantum had expired.
+                if ( running != nullptr )
+                {
+                    unsigned end = this->preemptAt( event.pcb , running , started , turn_end ) ;
+                    if ( end < turn_end )
+                    {
+                        turn_end = end ;
+                        events.push( turn_end , EventKind::QUANTUM_EXPIRY , running , ++ turn ) ;
+                    }
+                }
+            }
+            else
+            {
+                this->endTurn( running , this->elapsed_time - started ) ;
+                running = nullptr ;
+            }
+
+            // Events of turns that were cut short are dropped now, so they
+            // can't keep the CPU idle while processes are ready.
+            while ( not events.isEmpty() and events.top().kind != EventKind::ARRIVAL
+                and events.top().turn != turn )
+                events.pop() ;
+
+            // Once nothing else happens at this time, a free CPU takes the
+            // next ready process.
+            if ( running == nullptr
+                and ( events.isEmpty() or events.top().time > this->elapsed_time ) )
+            {
+                running = this->nextReady() ;
+                if ( running != nullptr )
+                {
+                    if ( not running->dispatched )
+                    {
+                        running->dispatched = true ;
+                        running->response_time = this->elapsed_time - running->arrival_time ;
+                    }
+                    started = this->elapsed_time ;
+                    unsigned length = this->turnLength( running ) ;
+                    turn_end = started + length ;
+                    events.push( turn_end ,
+                                 length < running->burst_time - running->running_time
+                                     ? EventKind::QUANTUM_EXPIRY
+                                     : EventKind::COMPLETION ,
+                                 running , ++ turn ) ;
+                }
+            }
+        }
+        // The trace is written out before anything else is printed.
+        this->trace.flush() ;
+    }
+
+    /**
+     * @brief This function is called once after the simulation ends. It is used
+     * to print out the results of the simulation.
+     */
+    void print_results()
+    {
+        this->trace.flush() ;
+        // The lines are formatted a block at a time on another thread, so
+        // the next block is being formatted while this one is written.
+        const unsigned BLOCK = 4096 ;
+        unsigned n = this->stats.size() ;
+        std::future<std::string> next ;
+        if ( n > 0 )
+            next = this->stats.formatTextAsync( this->process_list , 0 , std::min( BLOCK , n ) ) ;
+        for ( unsigned begin = 0 ; begin < n ; begin += BLOCK )
+        {
+            std::string lines = next.get() ;
+            if ( begin + BLOCK < n )
+                next = this->stats.formatTextAsync( this->process_list , begin + BLOCK ,
+                                                    std::min( begin + 2 * BLOCK , n ) ) ;
+            fwrite( lines.data() , 1 , lines.size() , stdout ) ;
+        }
+
+        printf( "Average turn-around time = %.6g, Average waiting time = %.6g\n" ,
+            this->average_turnaround_time , this->average_waiting_time ) ;
+    }
+
+    /**
+     * @brief Writes the statistics of each completed process to a file.
+     * @param path The file name.
+     * @param format CSV, or the binary format described at ProcessStats::write.
+     * @return True if the whole file was written, otherwise false.
+     */
+    bool exportStats( const char * path , const StatsFormat & format ) const
+    {
+        return this->stats.write( path , this->process_list , format ) ;
+    }
+
+    /**
+     * @brief Chooses how each turn a process gets on the CPU is recorded:
+     * printed as text, which is the default, written to a binary trace file,
+     * or not recorded at all. Set it before the simulation starts.
+     * @param mode How turns are recorded.
+     * @param path The file a BINARY trace is written to.
+     * @return True if the mode was set, false if the trace file could not be
+     * created.
+     */
+    bool setTraceMode( const TraceMode & mode , const char * path = nullptr )
+    {
+        return this->trace.setMode( mode , path ) ;
+    }
+
+    /**
+     * @brief Gives the time the simulation has spent writing its trace, so
+     * it can be told apart from the time spent scheduling.
+     * @return The time in seconds.
+     */
+    double traceWriteSeconds() const
+    {
+        return this->trace.writeSeconds() ;
+    }
+
+    /**
+     * @brief Gives the number of turns processes have had on the CPU.
+     * @return The number of turns.
+     */
+    unsigned long getTurnsRun() const
+    {
+        return this->turns_run ;
+    }
+
 };
\ No newline at end of file
@@ -1,52 +1,82 @@
-/**
- * Assignment 3: CPU Scheduler
- * @file scheduler_priority.h
- * @author Corey Talbert
- * @brief This Scheduler class implements the priority scheduling algorithm.
- * @version 0.1
- * @date 11/4/2022
- */
-
-#ifndef ASSIGN3_SCHEDULER_PRIORITY_H
-#define ASSIGN3_SCHEDULER_PRIORITY_H
-#include "scheduler.h"
-
-/**
- * @brief Implements a CPU Scheduler using a highest-priority first algorithm.
- */
-class SchedulerPriority : public Scheduler
-{
-public:
-    /**
-     * @brief Construct a new SchedulerPriority object
-     */
-    SchedulerPriority() ;
-
-    /**
-     * @brief Destroy the SchedulerPriority object
-     */
-    ~SchedulerPriority() override ;
-
-    /**
-     * @brief This function is called once before the simulation starts. It is 
-     * used to initialize the scheduler.
-     * @param process_list The list of processes in the simulation.
-     */
-    void init( std::vector<PCB> & process_list ) override ;
-
-    /**
-     * @brief Sort the ready queue by descending priority (higher value is
-     * higher priority).
-     * @param process_list The ready queue of waiting processes.
-     */
-    void sort( std::vector<PCB> & process_list ) ;
-
-    /**
-     * @brief This function simulates the scheduling of processes in the ready
-     * queue. It stops when all processes are finished.
-     */
-    void simulate() override ;
-
-};
-
-#endif //ASSIGN3_SCHEDULER_PRIORITY_H
+/**
+ * Assignment 3: CPU Scheduler
+ * @file scheduler_priority.h
+ * @author Corey Talbert
+ * @brief This Scheduler class implements the priority scheduling algorithm.
+ * @version 0.1
+ * @date 11/4/2022
+ */
+
+#ifndef ASSIGN3_SCHEDULER_PRIORITY_H
+#define ASSIGN3_SCHEDULER_PRIORITY_H
+#include <climits>
+#include <functional>
+#include <queue>
+#include "process_order.h"
+#include "scheduler.h"
+
+/**
+ * @brief Implements a CPU Scheduler using a highest-priority first algorithm.
+ */
+class SchedulerPriority : public Scheduler
+{
+private:
+    // The indexes of process_list in the order the processes run when they
+    // are all ready at once: by priority, ties in process_list order.
+    std::vector<unsigned> order ;
+    // The position of each process in order, indexed like process_list.
+    std::vector<unsigned> rank ;
+    // True if every process arrives at the same time. The processes then run
+    // straight through order and the heap is not used.
+    bool all_at_once = true ;
+    // The number of processes that have arrived, and the number taken from
+    // order, while all_at_once.
+    unsigned arrived = 0 ;
+    unsigned next_in_order = 0 ;
+    // The ready queue of processes as a min-heap of ranks, when processes
+    // arrive at different times.
+    std::priority_queue< unsigned , std::vector<unsigned> ,
+                         std::greater<unsigned> > ready_queue ;
+
+protected:
+    /**
+     * @brief Adds a process to the ready queue.
+     * @param pcb The process.
+     */
+    void addReady( PCB * pcb ) override ;
+
+    /**
+     * @brief Removes the ready process with the highest priority.
+     * @return The process, or nullptr if the ready queue is empty.
+     */
+    PCB * nextReady() override ;
+
+public:
+    /**
+     * @brief Construct a new SchedulerPriority object
+     */
+    SchedulerPriority() ;
+
+    /**
+     * @brief Destroy the SchedulerPriority object
+     */
+    ~SchedulerPriority() override ;
+
+    /**
+     * @brief This function is called once before the simulation starts. It is 
+     * used to initialize the scheduler.
+     * @param process_list The list of processes in the simulation.
+     */
+    void init( std::vector<PCB> & process_list ) override ;
+
+    /**
+     * @brief Sort the processes by descending priority (higher value is
+     * higher priority), into member order. The PCBs are not moved. Equal
+     * priorities keep their list order.
+     * @param process_list The processes.
+     */
+    void sort( const std::vector<PCB> & process_list ) ;
+
+};
+
+#endif //ASSIGN3_SCHEDULER_PRIORITY_H
@@ -1,184 +1,294 @@
-/**
- * Assignment 3: CPU Scheduler
- * @file scheduler_rr.cpp
- * @author Corey Talbert
- * @brief This Scheduler class implements the round robin scheduling algorithm.
- * @version 0.1
- * @date 11/4/2022
- */
-
-#include "scheduler_rr.h"
-
-/**
- * @brief Construct a new SchedulerRR object.
- */
-SchedulerRR::SchedulerRR( int time_quantum ) : slice( time_quantum ) {}
-
-/**
- * @brief Destroy the SchedulerRR object.
- */
-SchedulerRR::~SchedulerRR() { delete this->ready_queue ; }
-
-/**
- * @brief This function is called once before the simulation starts. It is
- * used to initialize the scheduler.
- * @param process_list The list of processes in the simulation.
- */
-void SchedulerRR::init( std::vector<PCB> & process_list )
-{
-    this->process_list = process_list ;
-    this->ready_queue = new List( process_list ) ;
-    this->clearSchedulerStats() ;
-    this->stats = new char * [ process_list.size() ] ;
-    memset( this->stats , 0 , sizeof( char * ) * process_list.size() ) ;
-}
-
-/**
- * @brief This function simulates the scheduling of processes in the ready
- * queue. It stops when all processes are finished.
- */
-void SchedulerRR::simulate()
-{
-    while ( not this->ready_queue->isEmpty() )
-    {
-        PCB * current_task = this->ready_queue->pop_front() ;
-        // Each process takes time equal to the lesser of the time slice or its
-        // remaining burst time.
-        unsigned turn_time = ( this->slice <= current_task->burst_time - current_task->running_time )
-            ? this->slice
-            : current_task->burst_time - current_task->running_time ;
-        printf( "Running Process %s for %u time units\n" , current_task->name.c_str() , turn_time ) ;
-        // The waiting time of the process considers the scheduler's overall
-        // elapsed time less the time this process has spent running up to now.
-        // The process must have been waiting if it wasn't running! 
-        current_task->waiting_time = this->elapsed_time - current_task->running_time ;
-        // The process's running time is increased by the turn time length.
-        current_task->running_time += turn_time ;
-        // If the task's running time is equal to its burst time, the process is
-        // complete.
-        if ( current_task->running_time >= current_task->burst_time )
-        {
-            // The process's turnaround time can be calculated as the sum of its
-            // running time and waiting time.
-            current_task->turnaround_time = current_task->running_time + current_task->waiting_time ;
-            // The process's updated total wait time is added to the scheduler's
-            // total of cumulative process waiting time.
-            this->increaseAggregateWaitingTime( current_task->waiting_time ) ;
-            // The scheduler tracks the cumulative turnaround times of all 
-            // processes to determine the overall average.
-            this->increaseAggregateTurnaroundTime( current_task->turnaround_time ) ;
-            // The scheduler's counter of finished processes is updated. 
-            // It's used to calculate average turnaround and waiting times.
-            this->incrementProcessesCompleted() ;
-            // The final process stats are stored to an array held by the 
-            // scheduler.
-            this->saveStats( current_task ) ;
-        }
-        // If the process still has time remaining, it is moved to the end of 
-        // the ready queue.
-        else
-            this->ready_queue->push_back( current_task ) ;
-
-        // The turn time is added to the scheduler's overall elapsed time.
-        this->increaseElapsedTime( turn_time ) ;
-    } // End of while loop.
-}
-
-/******************************************************************************\
-|* SchedulerRR::List defintions                                               *|
-\******************************************************************************/
-
-/**
- * @brief Default constructor. Creates an empty list with size 0.
- */
-SchedulerRR::List::List() {}
-
-/**
- * @brief Creates a list from a vector of PCBs.
- * @param vec The vector of processes.
- */
-SchedulerRR::List::List( std::vector<PCB> & vec )
-{
-    unsigned new_size = vec.size() ;
-    for ( unsigned i = 0 ; i < new_size ; ++i )
-    {
-        PCB * new_data = &vec[ i ] ;
-        this->push_back( new_data ) ;
-    }
-    this->size = new_size ;
-}
-    
-/**
- * @brief Destructor.
- */
-SchedulerRR::List::~List() { this->clear() ; }
-
-/**
- * @brief Indicates if the the list is empty.
- * @return True if the list is empty, otherwise false.
- */
-bool SchedulerRR::List::isEmpty() const { return not this->size ; }
-
-/**
- * @brief Deletes all nodes in the list and sets the list size to 0. 
- */
-void SchedulerRR::List::clear()
-{
-    if ( not this->isEmpty() )
-    {
-        Node * itr = this->head ;
-        Node * temp ;
-        while ( itr != nullptr )
-        {
-            temp = itr ;
-            itr = itr->next ;
-            delete temp ;
-        }
-        this->head = nullptr ;
-        this->tail = nullptr ;
-        this->size = 0 ;
-    }
-}
-
-/**
- * @brief Removes the first (head) node of the list. 
- * @return The PCB pointer contained in the list head node.
- */
-PCB * SchedulerRR::List::pop_front()
-{
-    PCB * result = nullptr ;
-    Node * delete_target = nullptr ;
-    if ( not this->isEmpty() )
-    {
-        result = this->head->data ;
-        delete_target = this->head ;
-        this->head = this->head->next ;
-        if ( this->head != nullptr )
-            this->head->prev = nullptr ;
-        if ( delete_target != nullptr )
-            delete delete_target ;
-    }
-    -- this->size ;
-    return result ;
-}
-
-/**
- * @brief Appends a node containing a given PCB pointer to the list. 
- * @param new_data The PCB pointer to be appended to the list.
- */
-void SchedulerRR::List::push_back( PCB * new_data )
-{
-    Node * new_node = new Node( new_data ) ;
-    if ( this->isEmpty() )
-    {
-        this->head = new_node ;
-        this->tail = new_node ;
-    }
-    else
-    {
-        this->tail->next = new_node ;
-        new_node->prev = this->tail ;
-        this->tail = new_node ;
-    }
-    ++ this->size ;
-}
\ No newline at end of file
+/**
+ * Assignment 3: CPU Scheduler
+ * @file scheduler_rr.cpp
+ * @author Corey Talbert
+ * @brief This Scheduler class implements the round robin scheduling algorithm.
+ * @version 0.1
+ * @date 11/4/2022
+ */
+
+#include "scheduler_rr.h"
+
+/**
+ * @brief Construct a new SchedulerRR object.
+ */
+SchedulerRR::SchedulerRR( int time_quantum ) : slice( time_quantum ) {}
+
+/**
+ * @brief Destroy the SchedulerRR object.
+ */
+SchedulerRR::~SchedulerRR() { delete this->ready_queue ; }
+
+/**
+ * @brief This function is called once before the simulation starts. It is
+ * used to initialize the scheduler.
+ * @param process_list The list of processes in the simulation.
+ */
+void SchedulerRR::init( std::vector<PCB> & process_list )
+{
+    this->process_list = process_list ;
+    // The queue starts empty; processes join it as they arrive.
+    delete this->ready_queue ;
+    this->ready_queue = new List() ;
+    this->clearSchedulerStats( process_list.size() ) ;
+}
+
+/**
+ * @brief Adds a process to the back of the ready queue. Processes whose turn
+ * ends before they are complete go to the back of the queue as well.
+ * @param pcb The process.
+ */
+void SchedulerRR::addReady( PCB * pcb )
+{
+    this->ready_queue->push_back( pcb ) ;
+}
+
+/**
+ * @brief Removes the process at the front of the ready queue.
+ * @return The process, or nullptr if the ready queue is empty.
+ */
+PCB * SchedulerRR::nextReady()
+{
+    return this->ready_queue->isEmpty() ? nullptr : this->ready_queue->pop_front() ;
+}
+
+/**
+ * @brief Gives the lesser of the time slice and the process's remaining
+ * burst time.
+ * @param pcb The process.
+ * @return The length of its turn.
+ */
+unsigned SchedulerRR::turnLength( PCB * pcb )
+{
+    return ( this->slice <= pcb->burst_time - pcb->running_time )
+        ? this->slice
+        : pcb->burst_time - pcb->running_time ;
+}
+
+/**
+ * @brief Turns the bulk round computation of simulate on or off. It is off
+ * by default.
+ * @param enabled True to allow bulk rounds.
+ */
+void SchedulerRR::setBulkRounds( const bool & enabled )
+{
+    this->bulk_rounds = enabled ;
+}
+
+/**
+ * @brief Simulates the scheduling of the processes. With bulk rounds on,
+ * every process arriving at once and no trace being recorded, whole rounds
+ * are computed at once. Otherwise the event loop runs a turn at a time.
+ */
+void SchedulerRR::simulate()
+{
+    bool same_arrival = true ;
+    for ( const PCB & pcb : this->process_list )
+        if ( pcb.arrival_time != this->process_list[ 0 ].arrival_time )
+            same_arrival = false ;
+    // Bulk rounds skip the turns, so they can't be used when the turns are
+    // traced. A zero time slice never ends a round.
+    if ( this->bulk_rounds and same_arrival and not this->process_list.empty()
+        and this->slice != 0 and this->trace.getMode() == TraceMode::SILENT )
+        this->simulateRounds() ;
+    else
+        Scheduler::simulate() ;
+}
+
+/**
+ * @brief Runs the simulation a round at a time. With every process arriving
+ * at once, the ready queue only ever rotates: in each round every process
+ * not yet complete runs once, in list order, for a full slice or until it
+ * completes. A process with burst time b therefore completes in round
+ * ceil( b / slice ), and the processes are taken in order of that round. The
+ * rounds between two completions are skipped in one step, and a Fenwick tree
+ * over the list counts the processes still running ahead of a completing
+ * one. The processes complete in the same order and at the same times as in
+ * the event loop, so the statistics are identical.
+ */
+void SchedulerRR::simulateRounds()
+{
+    unsigned n = this->process_list.size() ;
+    unsigned long slice = this->slice ;
+    // The round each process completes in. A process with no burst time
+    // still gets one empty turn.
+    std::vector<unsigned> rounds( n ) ;
+    for ( unsigned i = 0 ; i < n ; ++i )
+    {
+        unsigned burst = this->process_list[ i ].burst_time ;
+        rounds[ i ] = burst == 0 ? 1 : ( burst - 1 ) / slice + 1 ;
+        this->turns_run += rounds[ i ] ;
+    }
+    // The processes by completion round, in list order within a round.
+    std::vector<unsigned> order = sortedOrder( this->process_list ,
+        [ & ] ( const PCB & pcb ) { return rounds[ &pcb - this->process_list.data() ] ; } ) ;
+
+    // Every process has its first turn in the first round.
+    unsigned long now = this->process_list[ 0 ].arrival_time ;
+    unsigned long first_turn = now ;
+    for ( PCB & pcb : this->process_list )
+    {
+        pcb.dispatched = true ;
+        pcb.response_time = first_turn - pcb.arrival_time ;
+        first_turn += std::min( slice , ( unsigned long ) pcb.burst_time ) ;
+    }
+
+    // A Fenwick tree of the processes not yet complete, by list index:
+    // running[ i ] counts those in the block of list indexes ending at i - 1.
+    std::vector<unsigned> running( n + 1 , 0 ) ;
+    for ( unsigned i = 1 ; i <= n ; ++i )
+    {
+        ++ running[ i ] ;
+        unsigned parent = i + ( i & -i ) ;
+        if ( parent <= n )
+            running[ parent ] += running[ i ] ;
+    }
+    unsigned remaining = n ;
+    // The round that starts at time now.
+    unsigned long round = 1 ;
+
+    for ( unsigned first = 0 ; first < n ; )
+    {
+        // Nobody completes before round k, so every process still running
+        // has a full slice in each round up to it.
+        unsigned long k = rounds[ order[ first ] ] ;
+        now += ( k - round ) * slice * remaining ;
+        unsigned last = first ;
+        while ( last < n and rounds[ order[ last ] ] == k )
+            ++ last ;
+
+        // The processes that complete in round k, in list order. Each one
+        // waits for a full slice of every process ahead of it that keeps
+        // running, and for what was left of each one ahead that completed.
+        unsigned long completed_time = 0 ;
+        for ( unsigned c = first ; c < last ; ++c )
+        {
+            unsigned i = order[ c ] ;
+            unsigned ahead = 0 ;
+            for ( unsigned j = i ; j > 0 ; j -= j & -j )
+                ahead += running[ j ] ;
+            PCB * pcb = &this->process_list[ i ] ;
+            unsigned long left = pcb->burst_time - ( k - 1 ) * slice ;
+            completed_time += left ;
+            this->elapsed_time = now + ( ahead - ( c - first ) ) * slice + completed_time ;
+            pcb->running_time = pcb->burst_time ;
+            this->complete( pcb ) ;
+        }
+        now += ( remaining - ( last - first ) ) * slice + completed_time ;
+
+        for ( unsigned c = first ; c < last ; ++c )
+            for ( unsigned j = order[ c ] + 1 ; j <= n ; j += j & -j )
+                -- running[ j ] ;
+        remaining -= last - first ;
+        round = k + 1 ;
+        first = last ;
+    }
+}
+
+/******************************************************************************\
+|* SchedulerRR::List defintions                                               *|
+\******************************************************************************/
+
+/**
+ * @brief Default constructor. Creates an empty list with size 0.
+ */
+SchedulerRR::List::List() {}
+
+/**
+ * @brief Creates a list from a vector of PCBs.
+ * @param vec The vector of processes.
+ */
+SchedulerRR::List::List( std::vector<PCB> & vec )
+{
+    unsigned new_size = vec.size() ;
+    for ( unsigned i = 0 ; i < new_size ; ++i )
+    {
+        PCB * new_data = &vec[ i ] ;
+        this->push_back( new_data ) ;
+    }
+    this->size = new_size ;
+}
+    
+/**
+ * @brief Destructor.
+ */
+SchedulerRR::List::~List() { this->clear() ; }
+
+/**
+ * @brief Indicates if the the list is empty.
+ * @return True if the list is empty, otherwise false.
+ */
+bool SchedulerRR::List::isEmpty() const { return not this->size ; }
+
+/**
+ * @brief Returns all nodes in the list to the pool and sets the list size to 0.
+ */
+void SchedulerRR::List::clear()
+{
+    if ( not this->isEmpty() )
+    {
+        Node * itr = this->head ;
+        Node * temp ;
+        while ( itr != nullptr )
+        {
+            temp = itr ;
+            itr = itr->next ;
+            this->pool.release( temp ) ;
+        }
+        this->head = nullptr ;
+        this->tail = nullptr ;
+        this->size = 0 ;
+    }
+}
+
+/**
+ * @brief Removes the first (head) node of the list. 
+ * @return The PCB pointer contained in the list head node.
+ */
+PCB * SchedulerRR::List::pop_front()
+{
+    PCB * result = nullptr ;
+    Node * delete_target = nullptr ;
+    if ( not this->isEmpty() )
+    {
+        result = this->head->data ;
+        delete_target = this->head ;
+        this->head = this->head->next ;
+        if ( this->head != nullptr )
+            this->head->prev = nullptr ;
+        if ( delete_target != nullptr )
+            this->pool.release( delete_target ) ;
+    }
+    -- this->size ;
+    return result ;
+}
+
+/**
+ * @brief Appends a node containing a given PCB pointer to the list. 
+ * @param new_data The PCB pointer to be appended to the list.
+ */
+void SchedulerRR::List::push_back( PCB * new_data )
+{
+    Node * new_node = this->pool.acquire( new_data ) ;
+    if ( this->isEmpty() )
+    {
+        this->head = new_node ;
+        this->tail = new_node ;
+    }
+    else
+    {
+        this->tail->next = new_node ;
+        new_node->prev = this->tail ;
+        this->tail = new_node ;
+    }
+    ++ this->size ;
+}
+
+/**
+ * @brief Gives the usage statistics of the node pool.
+ * @return The capacity, nodes in use, high-water mark and chunks.
+ */
+NodePoolStats SchedulerRR::List::getPoolStats() const
+{
+    return this->pool.getStats() ;
+}
@@ -1,115 +1,166 @@
-/**
- * Assignment 3: CPU Scheduler
- * @file scheduler_rr.h
- * @author Corey Talbert
- * @brief This Scheduler class implements the round robin scheduling algorithm.
- * @version 0.1
- * @date 11/4/2022
- */
-
-#ifndef ASSIGN3_SCHEDULER_RR_H
-#define ASSIGN3_SCHEDULER_RR_H
-
-#include "scheduler.h"
-
-class SchedulerRR : public Scheduler
-{
-private:
-    /**
-     * @brief A linked list to hold PCBs of the same priority.
-     */
-    class List
-    {
-    private:
-        /**
-         * @brief A doubly-linked list node containing a PCB.
-         */
-        struct Node
-        {
-            Node * prev = nullptr ;
-            Node * next = nullptr ;
-            PCB * data = nullptr ;
-            Node( PCB * new_data )
-                : prev( nullptr ) , next( nullptr ) , data( new_data )
-            {}
-        } ;
-        // The first node of the list.
-        Node * head = nullptr ;
-        // The last node of the list.
-        Node * tail = nullptr ;
-        // The number of nodes in the list.
-        unsigned size = 0 ;
-
-    public:
-        /**
-         * @brief Default constructor. Creates an empty list with size 0.
-         */
-        List();
-
-        /**
-         * @brief Creates a list from a vector of PCBs.
-         * @param vec The vector of processes.
-         */
-        List( std::vector<PCB> & vec ) ;
-
-        /**
-         * @brief Destructor.
-         */
-        ~List() ;
-
-        /**
-         * @brief Indicates if the the list is empty.
-         * @return True if the list is empty, otherwise false.
-         */
-        bool isEmpty() const ;
-
-        /**
-         * @brief Deletes all nodes in the list and sets the list size to 0.
-         */
-        void clear() ;
-
-        /**
-         * @brief Removes the first (head) node of the list.
-         * @return The PCB pointer contained in the list head node.
-         */
-        PCB * pop_front() ;
-
-        /**
-         * @brief Appends a node containing a given PCB pointer to the list.
-         * @param new_data The PCB pointer to be appended to the list.
-         */
-        void push_back( PCB * new_data ) ;
-
-    } ; // End of List
-
-    // The ready queue of processes.
-    List * ready_queue = nullptr ;
-    // The time slice allocated to running processes.
-    unsigned slice = 0 ;
-
-public:
-    /**
-     * @brief Construct a new SchedulerRR object.
-     */
-    SchedulerRR( int = 10 ) ;
-
-    /**
-     * @brief Destroy the SchedulerRR object.
-     */
-    ~SchedulerRR() override ;
-
-    /**
-     * @brief This function is called once before the simulation starts. It is
-     * used to initialize the scheduler.
-     * @param process_list The list of processes in the simulation.
-     */
-    void init( std::vector<PCB> & process_list ) override ;
-
-    /**
-     * @brief This function simulates the scheduling of processes in the ready queue.
-     *        It stops when all processes are finished.
-     */
-    void simulate() override ;
-} ;
-
+/**
+ * Assignment 3: CPU Scheduler
+ * @file scheduler_rr.h
+ * @author Corey Talbert
+ * @brief This Scheduler class implements the round robin scheduling algorithm.
+ * @version 0.1
+ * @date 11/4/2022
+ */
+
+#ifndef ASSIGN3_SCHEDULER_RR_H
+#define ASSIGN3_SCHEDULER_RR_H
+
+#include "scheduler.h"
+#include "nodepool.h"
+#include "process_order.h"
+
+class SchedulerRR : public Scheduler
+{
+private:
+    /**
+     * @brief A linked list to hold PCBs of the same priority.
+     */
+    class List
+    {
+    private:
+        /**
+         * @brief A doubly-linked list node containing a PCB.
+         */
+        struct Node
+        {
+            Node * prev = nullptr ;
+            Node * next = nullptr ;
+            PCB * data = nullptr ;
+            Node( PCB * new_data )
+                : prev( nullptr ) , next( nullptr ) , data( new_data )
+            {}
+        } ;
+        // The first node of the list.
+        Node * head = nullptr ;
+        // The last node of the list.
+        Node * tail = nullptr ;
+        // The number of nodes in the list.
+        unsigned size = 0 ;
+        // The pool the nodes are taken from and returned to.
+        NodePool<Node> pool ;
+
+    public:
+        /**
+         * @brief Default constructor. Creates an empty list with size 0.
+         */
+        List();
+
+        /**
+         * @brief Creates a list from a vector of PCBs.
+         * @param vec The vector of processes.
+         */
+        List( std::vector<PCB> & vec ) ;
+
+        /**
+         * @brief Destructor.
+         */
+        ~List() ;
+
+        /**
+         * @brief Indicates if the the list is empty.
+         * @return True if the list is empty, otherwise false.
+         */
+        bool isEmpty() const ;
+
+        /**
+         * @brief Deletes all nodes in the list and sets the list size to 0.
+         */
+        void clear() ;
+
+        /**
+         * @brief Removes the first (head) node of the list.
+         * @return The PCB pointer contained in the list head node.
+         */
+        PCB * pop_front() ;
+
+        /**
+         * @brief Appends a node containing a given PCB pointer to the list.
+         * @param new_data The PCB pointer to be appended to the list.
+         */
+        void push_back( PCB * new_data ) ;
+
+        /**
+         * @brief Gives the usage statistics of the node pool.
+         * @return The capacity, nodes in use, high-water mark and chunks.
+         */
+        NodePoolStats getPoolStats() const ;
+
+    } ; // End of List
+
+    // The ready queue of processes.
+    List * ready_queue = nullptr ;
+    // The time slice allocated to running processes.
+    unsigned slice = 0 ;
+    // Whether simulate may compute whole rounds at once instead of running
+    // the event loop.
+    bool bulk_rounds = false ;
+
+    /**
+     * @brief Runs the simulation a round at a time: every full round between
+     * two completions is skipped in one step, and only the completions are
+     * worked out. Needs every process to arrive at the same time.
+     */
+    void simulateRounds() ;
+
+protected:
+    /**
+     * @brief Adds a process to the back of the ready queue.
+     * @param pcb The process.
+     */
+    void addReady( PCB * pcb ) override ;
+
+    /**
+     * @brief Removes the process at the front of the ready queue.
+     * @return The process, or nullptr if the ready queue is empty.
+     */
+    PCB * nextReady() override ;
+
+    /**
+     * @brief Gives the lesser of the time slice and the process's remaining
+     * burst time.
+     * @param pcb The process.
+     * @return The length of its turn.
+     */
+    unsigned turnLength( PCB * pcb ) override ;
+
+public:
+    /**
+     * @brief Construct a new SchedulerRR object.
+     */
+    SchedulerRR( int = 10 ) ;
+
+    /**
+     * @brief Destroy the SchedulerRR object.
+     */
+    ~SchedulerRR() override ;
+
+    /**
+     * @brief This function is called once before the simulation starts. It is
+     * used to initialize the scheduler.
+     * @param process_list The list of processes in the simulation.
+     */
+    void init( std::vector<PCB> & process_list ) override ;
+
+    /**
+     * @brief Simulates the scheduling of the processes. With bulk rounds on,
+     * every process arriving at once and no trace being recorded, whole
+     * rounds are computed at once and the time taken no longer grows with
+     * the burst times. Otherwise the event loop runs a turn at a time. The
+     * statistics are the same either way.
+     */
+    void simulate() override ;
+
+    /**
+     * @brief Turns the bulk round computation of simulate on or off. It is
+     * off by default.
+     * @param enabled True to allow bulk rounds.
+     */
+    void setBulkRounds( const bool & enabled ) ;
+} ;
+
 #endif //ASSIGN3_SCHEDULER_RR_H
\ No newline at end of file
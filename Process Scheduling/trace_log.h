@@ -0,0 +1,211 @@
+/**
+ * Assignment 3: CPU Scheduler
+ * @file trace_log.h
+ * @author Corey Talbert
+ * @brief TraceLog records each turn a process gets on the CPU. The turns
+ * are written as text lines to stdout, as compact binary records to a file,
+ * or not at all. Either way they go through one large buffer, so a
+ * simulation with many short turns is not held up by a write per turn.
+ * @version 0.1
+ * @date 11/4/2022
+ */
+
+#pragma once
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <vector>
+#include "pcb.h"
+
+/**
+ * @brief How the turns of a simulation are recorded.
+ * TEXT prints "Running Process <name> for <n> time units" for each turn.
+ * BINARY writes a TraceRecord for each turn to a file.
+ * SILENT records nothing.
+ */
+enum class TraceMode { TEXT , BINARY , SILENT } ;
+
+/**
+ * @brief One turn in a binary trace. A trace file is the 4-byte magic
+ * number "PEV1" followed by the records, in host byte order.
+ */
+struct TraceRecord
+{
+    // The time the turn started.
+    uint32_t start ;
+    // The index of the process in the process list.
+    uint32_t id ;
+    // How long the process ran.
+    uint32_t length ;
+} ;
+
+static_assert( sizeof( TraceRecord ) == 12 , "TraceRecord must stay at 12 bytes" ) ;
+
+// The size of the trace write buffer.
+const size_t TRACE_BUFFER_SIZE = 1 << 20 ;
+// The longest text line of a turn, less the process name: the fixed words
+// and a 10-digit number.
+const size_t TRACE_LINE_SIZE = 48 ;
+
+/**
+ * @brief The buffered record of the turns of a simulation.
+ */
+class TraceLog
+{
+private:
+    // How turns are recorded.
+    TraceMode mode = TraceMode::TEXT ;
+    // Where they are written: stdout for text, otherwise the trace file.
+    FILE * file = stdout ;
+    // The bytes not yet written.
+    std::vector<char> buffer ;
+    size_t used = 0 ;
+    // The time spent in writes so far, in seconds.
+    double write_seconds = 0 ;
+
+    /**
+     * @brief Makes room in the buffer for n more bytes, writing it out if
+     * it would not fit.
+     * @param n The number of bytes.
+     */
+    void reserve( const size_t & n )
+    {
+        if ( this->buffer.empty() )
+            this->buffer.resize( TRACE_BUFFER_SIZE ) ;
+        if ( this->used + n > this->buffer.size() )
+        {
+            this->flush() ;
+            if ( n > this->buffer.size() )
+                this->buffer.resize( n ) ;
+        }
+    }
+
+public:
+    /**
+     * @brief Construct a TraceLog that prints text to stdout.
+     */
+    TraceLog() {}
+
+    /**
+     * @brief Destroy the TraceLog object. What is still buffered is written.
+     */
+    ~TraceLog()
+    {
+        this->close() ;
+    }
+
+    TraceLog( const TraceLog & ) = delete ;
+    TraceLog & operator=( const TraceLog & ) = delete ;
+
+    /**
+     * @brief Chooses how turns are recorded from now on. Anything recorded
+     * before is written first, and a trace file opened before is closed.
+     * @param mode How turns are recorded.
+     * @param path The file a BINARY trace is written to. Not used otherwise.
+     * @return True if the mode was set, false if the trace file could not be
+     * created, which leaves the log SILENT.
+     */
+    bool setMode( const TraceMode & mode , const char * path = nullptr )
+    {
+        this->close() ;
+        this->mode = mode ;
+        if ( mode != TraceMode::BINARY )
+            return true ;
+        this->file = path != nullptr ? fopen( path , "wb" ) : nullptr ;
+        if ( this->file == nullptr or fwrite( "PEV1" , 4 , 1 , this->file ) != 1 )
+        {
+            this->close() ;
+            this->mode = TraceMode::SILENT ;
+            return false ;
+        }
+        return true ;
+    }
+
+    /**
+     * @brief Gives how turns are recorded.
+     * @return The mode.
+     */
+    TraceMode getMode() const { return this->mode ; }
+
+    /**
+     * @brief Records one turn of a process on the CPU.
+     * @param pcb The process.
+     * @param id The index of the process in the process list.
+     * @param start The time the turn started.
+     * @param length How long the process ran.
+     */
+    void turn( const PCB & pcb , const unsigned & id , const unsigned & start ,
+               const unsigned & length )
+    {
+        if ( this->mode == TraceMode::SILENT )
+            return ;
+        if ( this->mode == TraceMode::BINARY )
+        {
+            TraceRecord record = { start , id , length } ;
+            this->reserve( sizeof( record ) ) ;
+            memcpy( &this->buffer[ this->used ] , &record , sizeof( record ) ) ;
+            this->used += sizeof( record ) ;
+            return ;
+        }
+        // The line is put together by hand; snprintf would cost more than
+        // the rest of the turn.
+        this->reserve( TRACE_LINE_SIZE + pcb.name.size() ) ;
+        char * out = &this->buffer[ this->used ] ;
+        char * begin = out ;
+        memcpy( out , "Running Process " , 16 ) ;
+        out += 16 ;
+        memcpy( out , pcb.name.data() , pcb.name.size() ) ;
+        out += pcb.name.size() ;
+        memcpy( out , " for " , 5 ) ;
+        out += 5 ;
+        char digits[ 10 ] ;
+        int count = 0 ;
+        unsigned n = length ;
+        do
+        {
+            digits[ count ++ ] = '0' + n % 10 ;
+            n /= 10 ;
+        } while ( n != 0 ) ;
+        while ( count > 0 )
+            * out ++ = digits[ -- count ] ;
+        memcpy( out , " time units\n" , 12 ) ;
+        out += 12 ;
+        this->used += out - begin ;
+    }
+
+    /**
+     * @brief Writes out what is buffered.
+     */
+    void flush()
+    {
+        if ( this->used == 0 or this->file == nullptr )
+        {
+            this->used = 0 ;
+            return ;
+        }
+        auto start = std::chrono::steady_clock::now() ;
+        fwrite( this->buffer.data() , 1 , this->used , this->file ) ;
+        fflush( this->file ) ;
+        this->used = 0 ;
+        this->write_seconds += std::chrono::duration<double>( std::chrono::steady_clock::now() - start ).count() ;
+    }
+
+    /**
+     * @brief Writes out what is buffered and closes a trace file. Text goes
+     * on to stdout.
+     */
+    void close()
+    {
+        this->flush() ;
+        if ( this->file != nullptr and this->file != stdout )
+            fclose( this->file ) ;
+        this->file = stdout ;
+    }
+
+    /**
+     * @brief Gives the time spent writing the trace so far.
+     * @return The time in seconds.
+     */
+    double writeSeconds() const { return this->write_seconds ; }
+} ;
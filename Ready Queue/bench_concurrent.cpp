@@ -0,0 +1,366 @@
+/**
+ * Assignment 1: priority queue of processes
+ * @file bench_concurrent.cpp
+ * @author Corey Talbert
+ * @brief Scaling benchmark of ConcurrentReadyQueue against a ReadyQueue behind
+ * one global mutex, for 1 to 64 dispatcher threads, of waking threads
+ * handing PCBs to one scheduler thread through that mutex or through a
+ * SubmissionRing, and of PerCPUScheduler on 1 to 16 simulated CPUs with the
+ * work piled onto one of them.
+ * @version 0.1
+ * @date 09-19-2022
+ */
+
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <cstdio>
+#include <pthread.h>
+#include <sched.h>
+#include <vector>
+#include "readyqueue.h"
+#include "concurrent_readyqueue.h"
+#include "percpu_scheduler.h"
+#include "submission_ring.h"
+using namespace std::chrono ;
+
+/**
+ * @brief A ReadyQueue with one mutex around every call, the only way to
+ * share it between threads before ConcurrentReadyQueue.
+ */
+class LockedReadyQueue
+{
+private:
+    ReadyQueue<> queue ;
+    pthread_mutex_t mutex ;
+
+public:
+    LockedReadyQueue() { pthread_mutex_init( &mutex , NULL ) ; }
+    ~LockedReadyQueue() { pthread_mutex_destroy( &mutex ) ; }
+
+    void addPCB( PCB* pcb )
+    {
+        pthread_mutex_lock( &mutex ) ;
+        queue.addPCB( pcb ) ;
+        pthread_mutex_unlock( &mutex ) ;
+    }
+
+    PCB* removePCB()
+    {
+        pthread_mutex_lock( &mutex ) ;
+        PCB* pcb = queue.removePCB() ;
+        pthread_mutex_unlock( &mutex ) ;
+        return pcb ;
+    }
+} ;
+
+/**
+ * @brief The arguments of one benchmark thread.
+ */
+template <class Queue>
+struct Worker
+{
+    Queue* queue ;
+    pthread_barrier_t* start ;
+    unsigned ops ;
+    // The state of the thread's random priorities.
+    unsigned seed ;
+    // When the thread started and finished its operations.
+    high_resolution_clock::time_point t0 , t1 ;
+} ;
+
+/**
+ * @brief Each thread repeatedly dispatches the highest priority PCB and puts
+ * it back at a random priority, as a dispatcher would after its time slice
+ * once the process's priority has been recomputed. The adds land on every
+ * level, not just the one the removes take from.
+ * @param param The Worker of the thread.
+ * @return void
+ */
+template <class Queue>
+void* dispatcher( void* param )
+{
+    Worker<Queue>* w = ( Worker<Queue>* ) param ;
+    pthread_barrier_wait( w -> start ) ;
+    w -> t0 = high_resolution_clock::now() ;
+    for ( unsigned i = 0 ; i < w -> ops ; ++i )
+    {
+        PCB* pcb = w -> queue -> removePCB() ;
+        if ( pcb )
+        {
+            // xorshift, so picking a priority costs no lock of its own.
+            w -> seed ^= w -> seed << 13 ;
+            w -> seed ^= w -> seed >> 17 ;
+            w -> seed ^= w -> seed << 5 ;
+            pcb -> setPriority( MIN_PRIORITY + w -> seed % ( MAX_PRIORITY - MIN_PRIORITY + 1 ) ) ;
+            w -> queue -> addPCB( pcb ) ;
+        }
+    }
+    w -> t1 = high_resolution_clock::now() ;
+    return NULL ;
+}
+
+/**
+ * @brief Run the dispatcher threads against a queue preloaded with pcbs.
+ * @return double: millions of remove/add pairs per second over all threads
+ */
+template <class Queue>
+double run( unsigned threads , unsigned ops , std::vector<PCB> & pcbs )
+{
+    Queue queue ;
+    for ( PCB & pcb : pcbs )
+        queue.addPCB( &pcb ) ;
+
+    pthread_barrier_t start ;
+    pthread_barrier_init( &start , NULL , threads + 1 ) ;
+    std::vector<pthread_t> tids( threads ) ;
+    std::vector< Worker<Queue> > workers( threads ) ;
+    for ( unsigned i = 0 ; i < threads ; ++i )
+    {
+        workers[ i ] = Worker<Queue>{ &queue , &start , ops , 2463534242u + i ,
+                                      high_resolution_clock::time_point() ,
+                                      high_resolution_clock::time_point() } ;
+        pthread_create( &tids[ i ] , NULL , dispatcher<Queue> , &workers[ i ] ) ;
+    }
+    pthread_barrier_wait( &start ) ;
+    for ( pthread_t & tid : tids )
+        pthread_join( tid , NULL ) ;
+    pthread_barrier_destroy( &start ) ;
+
+    // The run lasts from the first thread starting to the last one finishing.
+    high_resolution_clock::time_point t0 = workers[ 0 ] . t0 , t1 = workers[ 0 ] . t1 ;
+    for ( Worker<Queue> & w : workers )
+    {
+        t0 = std::min( t0 , w . t0 ) ;
+        t1 = std::max( t1 , w . t1 ) ;
+    }
+
+    // Drain so the PCBs are free for the next run.
+    while ( queue.removePCB() ) ;
+    return ( double ) threads * ops / duration<double, std::micro>( t1 - t0 ).count() ;
+}
+
+/**
+ * @brief The arguments of one waking thread.
+ */
+struct Waker
+{
+    LockedReadyQueue* locked ;
+    SubmissionRing* ring ;
+    pthread_barrier_t* start ;
+    // The PCBs this thread wakes, each once.
+    PCB* pcbs ;
+    unsigned count ;
+} ;
+
+/**
+ * @brief Wake PCBs by adding them to the shared queue under its mutex.
+ * @param param The Waker of the thread.
+ * @return void
+ */
+void* wakeLocked( void* param )
+{
+    Waker* w = ( Waker* ) param ;
+    pthread_barrier_wait( w -> start ) ;
+    for ( unsigned i = 0 ; i < w -> count ; ++i )
+        w -> locked -> addPCB( &w -> pcbs[ i ] ) ;
+    return NULL ;
+}
+
+/**
+ * @brief Wake PCBs by pushing them into the ring, yielding while it is full.
+ * @param param The Waker of the thread.
+ * @return void
+ */
+void* wakeRing( void* param )
+{
+    Waker* w = ( Waker* ) param ;
+    pthread_barrier_wait( w -> start ) ;
+    for ( unsigned i = 0 ; i < w -> count ; ++i )
+        while ( not w -> ring -> push( &w -> pcbs[ i ] ) )
+            sched_yield() ;
+    return NULL ;
+}
+
+/**
+ * @brief Waking threads hand ops PCBs each to one scheduler thread, which
+ * dispatches them all. With the ring, the scheduler's ReadyQueue is private
+ * to it and drained into before each removal.
+ * @return double: millions of PCBs dispatched per second
+ */
+double runWakeups( unsigned producers , unsigned ops , bool use_ring )
+{
+    unsigned total = producers * ops ;
+    std::vector<PCB> pcbs( total ) ;
+    for ( unsigned i = 0 ; i < total ; ++i )
+        pcbs[ i ] = PCB( i , MIN_PRIORITY + rand() % ( MAX_PRIORITY - MIN_PRIORITY + 1 ) ) ;
+    LockedReadyQueue locked ;
+    SubmissionRing ring( 4096 ) ;
+    ReadyQueue<> own ;
+
+    pthread_barrier_t start ;
+    pthread_barrier_init( &start , NULL , producers + 1 ) ;
+    std::vector<pthread_t> tids( producers ) ;
+    std::vector<Waker> wakers( producers ) ;
+    for ( unsigned i = 0 ; i < producers ; ++i )
+    {
+        wakers[ i ] = Waker{ &locked , &ring , &start , &pcbs[ i * ops ] , ops } ;
+        pthread_create( &tids[ i ] , NULL , use_ring ? wakeRing : wakeLocked , &wakers[ i ] ) ;
+    }
+    pthread_barrier_wait( &start ) ;
+    high_resolution_clock::time_point t0 = high_resolution_clock::now() ;
+    for ( unsigned dispatched = 0 ; dispatched < total ; )
+    {
+        PCB* pcb ;
+        if ( use_ring )
+        {
+            ring.drainInto( own ) ;
+            pcb = own.removePCB() ;
+        }
+        else
+            pcb = locked.removePCB() ;
+        if ( pcb )
+            ++ dispatched ;
+        else
+            sched_yield() ;
+    }
+    high_resolution_clock::time_point t1 = high_resolution_clock::now() ;
+    for ( pthread_t & tid : tids )
+        pthread_join( tid , NULL ) ;
+    pthread_barrier_destroy( &start ) ;
+    return ( double ) total / duration<double, std::micro>( t1 - t0 ).count() ;
+}
+
+/**
+ * @brief The arguments of one simulated CPU thread.
+ */
+struct CPUWorker
+{
+    PerCPUScheduler* scheduler ;
+    pthread_barrier_t* start ;
+    unsigned cpu ;
+    unsigned ops ;
+    // The state of the thread's random choices.
+    unsigned seed ;
+    // When the thread started and finished its operations.
+    high_resolution_clock::time_point t0 , t1 ;
+} ;
+
+/**
+ * @brief Each CPU repeatedly dispatches a PCB and, after its time slice,
+ * wakes it again. Three times in four the PCB wakes on CPU 0, as if its
+ * I/O completed there, so the other CPUs run dry and must steal or be
+ * balanced to keep busy.
+ * @param param The CPUWorker of the thread.
+ * @return void
+ */
+void* cpuLoop( void* param )
+{
+    CPUWorker* w = ( CPUWorker* ) param ;
+    pthread_barrier_wait( w -> start ) ;
+    w -> t0 = high_resolution_clock::now() ;
+    for ( unsigned i = 0 ; i < w -> ops ; ++i )
+    {
+        PCB* pcb = w -> scheduler -> removePCB( w -> cpu ) ;
+        if ( pcb == nullptr )
+            continue ;
+        w -> seed ^= w -> seed << 13 ;
+        w -> seed ^= w -> seed >> 17 ;
+        w -> seed ^= w -> seed << 5 ;
+        w -> scheduler -> addPCB( w -> seed % 4 != 0 ? 0 : w -> cpu , pcb ) ;
+    }
+    w -> t1 = high_resolution_clock::now() ;
+    return NULL ;
+}
+
+/**
+ * @brief Run one thread per CPU against a PerCPUScheduler that starts with
+ * every PCB queued on CPU 0.
+ * @param counters Set to the counters of all CPUs added together.
+ * @return double: millions of dispatch attempts per second over all CPUs
+ */
+double runPerCPU( unsigned cpus , unsigned ops , std::vector<PCB> & pcbs ,
+                  unsigned balance_interval , CPUCounters & counters )
+{
+    PerCPUScheduler scheduler( cpus , balance_interval ) ;
+    for ( PCB & pcb : pcbs )
+        scheduler.addPCB( 0 , &pcb ) ;
+
+    pthread_barrier_t start ;
+    pthread_barrier_init( &start , NULL , cpus + 1 ) ;
+    std::vector<pthread_t> tids( cpus ) ;
+    std::vector<CPUWorker> workers( cpus ) ;
+    for ( unsigned i = 0 ; i < cpus ; ++i )
+    {
+        workers[ i ] = CPUWorker{ &scheduler , &start , i , ops , 2463534242u + i ,
+                                  high_resolution_clock::time_point() ,
+                                  high_resolution_clock::time_point() } ;
+        pthread_create( &tids[ i ] , NULL , cpuLoop , &workers[ i ] ) ;
+    }
+    pthread_barrier_wait( &start ) ;
+    for ( pthread_t & tid : tids )
+        pthread_join( tid , NULL ) ;
+    pthread_barrier_destroy( &start ) ;
+
+    high_resolution_clock::time_point t0 = workers[ 0 ] . t0 , t1 = workers[ 0 ] . t1 ;
+    for ( CPUWorker & w : workers )
+    {
+        t0 = std::min( t0 , w . t0 ) ;
+        t1 = std::max( t1 , w . t1 ) ;
+    }
+    counters = CPUCounters() ;
+    for ( unsigned i = 0 ; i < cpus ; ++i )
+    {
+        CPUCounters c = scheduler.getCounters( i ) ;
+        counters . dispatches += c . dispatches ;
+        counters . steals += c . steals ;
+        counters . migrations += c . migrations ;
+        counters . idle_ns += c . idle_ns ;
+    }
+
+    // Drain so the PCBs are free for the next run.
+    for ( unsigned i = 0 ; i < cpus ; ++i )
+        while ( scheduler.size( i ) > 0 )
+            scheduler.removePCB( i ) ;
+    return ( double ) cpus * ops / duration<double, std::micro>( t1 - t0 ).count() ;
+}
+
+int main( int argc , char * argv[] )
+{
+    // Operations per thread and number of queued PCBs, from the command line.
+    unsigned ops = argc > 1 ? atoi( argv[ 1 ] ) : 200000 ;
+    unsigned depth = argc > 2 ? atoi( argv[ 2 ] ) : 4096 ;
+    srand( 433 ) ;
+
+    std::vector<PCB> pcbs( depth ) ;
+    for ( unsigned i = 0 ; i < depth ; ++i )
+        pcbs[ i ] = PCB( i , MIN_PRIORITY + rand() % ( MAX_PRIORITY - MIN_PRIORITY + 1 ) ) ;
+
+    printf( "%-8s %16s %16s\n" , "threads" , "global Mops/s" , "per-level Mops/s" ) ;
+    for ( unsigned threads = 1 ; threads <= 64 ; threads *= 2 )
+    {
+        double global = run<LockedReadyQueue>( threads , ops , pcbs ) ;
+        double fine = run<ConcurrentReadyQueue>( threads , ops , pcbs ) ;
+        printf( "%-8u %16.2f %16.2f\n" , threads , global , fine ) ;
+    }
+
+    printf( "\n%-8s %16s %16s\n" , "wakers" , "global Mops/s" , "ring Mops/s" ) ;
+    for ( unsigned producers = 1 ; producers <= 16 ; producers *= 2 )
+    {
+        double global = runWakeups( producers , ops , false ) ;
+        double ring = runWakeups( producers , ops , true ) ;
+        printf( "%-8u %16.2f %16.2f\n" , producers , global , ring ) ;
+    }
+
+    printf( "\n%-8s %-8s %10s %12s %10s %12s %10s\n" , "cpus" , "balance" , "Mops/s" ,
+            "dispatches" , "steals" , "migrations" , "idle ms" ) ;
+    for ( unsigned cpus = 1 ; cpus <= 16 ; cpus *= 2 )
+        for ( unsigned interval : { 0u , 64u } )
+        {
+            CPUCounters c ;
+            double rate = runPerCPU( cpus , ops , pcbs , interval , c ) ;
+            printf( "%-8u %-8u %10.2f %12lu %10lu %12lu %10.2f\n" , cpus , interval , rate ,
+                    c . dispatches , c . steals , c . migrations , c . idle_ns / 1e6 ) ;
+        }
+    return 0 ;
+}
@@ -0,0 +1,197 @@
+/**
+ * Assignment 1: priority queue of processes
+ * @file bench_readyqueue.cpp
+ * @author Corey Talbert
+ * @brief Microbenchmark comparing the occupancy bitmap lookup of the highest
+ * priority list against the linear downward scan it replaced, on sparse and
+ * dense priority mixes, the whole queue across priority ranges, and the
+ * overhead of aging.
+ * @version 0.1
+ * @date 09-19-2022
+ */
+
+#include <chrono>
+#include <cstdlib>
+#include <cstdio>
+#include <vector>
+#include "readyqueue.h"
+using namespace std::chrono ;
+
+/**
+ * @brief The former top maintenance of ReadyQueue: a count per priority list
+ * and a downward walk to the next non-empty list whenever the top one empties.
+ */
+struct ScanTop
+{
+    unsigned count[ MAX_PRIORITY + 1 ] = { 0 } ;
+    unsigned top = 0 ;
+    unsigned size = 0 ;
+
+    void add( unsigned p )
+    {
+        ++ count[ p ] ;
+        ++ size ;
+        if ( top < p )
+            top = p ;
+    }
+
+    unsigned remove()
+    {
+        unsigned p = top ;
+        -- count[ top ] ;
+        if ( -- size == 0 )
+            top = 0 ;
+        else if ( count[ top ] == 0 )
+            while ( top > 0 and count[ --top ] == 0 ) ;
+        return p ;
+    }
+} ;
+
+/**
+ * @brief The bitmap top maintenance used by ReadyQueue.
+ */
+struct BitmapTop
+{
+    unsigned count[ MAX_PRIORITY + 1 ] = { 0 } ;
+    uint64_t occupancy = 0 ;
+    unsigned top = 0 ;
+
+    void add( unsigned p )
+    {
+        ++ count[ p ] ;
+        occupancy |= uint64_t( 1 ) << p ;
+        if ( top < p )
+            top = p ;
+    }
+
+    unsigned remove()
+    {
+        unsigned p = top ;
+        if ( -- count[ top ] == 0 )
+        {
+            occupancy &= ~( uint64_t( 1 ) << top ) ;
+            top = occupancy ? 63 - __builtin_clzll( occupancy ) : 0 ;
+        }
+        return p ;
+    }
+} ;
+
+/**
+ * @brief Build a stream of priorities for a mix.
+ * @param sparse If true, priorities are drawn only from the two extremes of
+ * the range, otherwise uniformly from the whole range.
+ * @param n The length of the stream.
+ * @param max_priority The highest priority of the range.
+ * @return std::vector<unsigned>: the priorities
+ */
+std::vector<unsigned> makeMix( bool sparse , unsigned n , unsigned max_priority = MAX_PRIORITY )
+{
+    std::vector<unsigned> mix( n ) ;
+    for ( unsigned & p : mix )
+        p = sparse
+            ? ( rand() % 2 ? max_priority : MIN_PRIORITY )
+            : MIN_PRIORITY + rand() % ( max_priority - MIN_PRIORITY + 1 ) ;
+    return mix ;
+}
+
+/**
+ * @brief Time a hold-model workload against a top tracker: the queue is
+ * filled to depth, then each step removes the top and adds the next priority.
+ * @return double: nanoseconds per remove/add pair
+ */
+template <class Tracker>
+double timeTracker( const std::vector<unsigned> & mix , unsigned depth , unsigned long & checksum )
+{
+    Tracker t ;
+    for ( unsigned i = 0 ; i < depth ; ++i )
+        t.add( mix[ i ] ) ;
+    high_resolution_clock::time_point start = high_resolution_clock::now() ;
+    for ( unsigned i = depth ; i < mix.size() ; ++i )
+    {
+        checksum += t.remove() ;
+        t.add( mix[ i ] ) ;
+    }
+    high_resolution_clock::time_point end = high_resolution_clock::now() ;
+    return duration<double, std::nano>( end - start ).count() / ( mix.size() - depth ) ;
+}
+
+/**
+ * @brief Time the same hold-model workload against a whole ReadyQueue.
+ * @param rate The aging rate, or 0 for no aging.
+ * @param cap The aging cap.
+ * @return double: nanoseconds per removePCB/addPCB pair
+ */
+template <unsigned LEVELS = MAX_PRIORITY + 1>
+double timeReadyQueue( const std::vector<unsigned> & mix , unsigned depth , unsigned long & checksum ,
+                       unsigned rate = 0 , unsigned cap = 0 )
+{
+    ReadyQueue<LEVELS> q ;
+    q.setAging( rate , cap ) ;
+    std::vector<PCB> pcbs( depth ) ;
+    for ( unsigned i = 0 ; i < depth ; ++i )
+    {
+        pcbs[ i ] = PCB( i , mix[ i ] ) ;
+        q.addPCB( &pcbs[ i ] ) ;
+    }
+    high_resolution_clock::time_point start = high_resolution_clock::now() ;
+    for ( unsigned i = depth ; i < mix.size() ; ++i )
+    {
+        PCB * pcb = q.removePCB() ;
+        checksum += pcb -> getPriority() ;
+        pcb -> setPriority( mix[ i ] ) ;
+        q.addPCB( pcb ) ;
+    }
+    high_resolution_clock::time_point end = high_resolution_clock::now() ;
+    return duration<double, std::nano>( end - start ).count() / ( mix.size() - depth ) ;
+}
+
+int main( int argc , char * argv[] )
+{
+    // Number of remove/add steps and steady queue depth, from the command line.
+    unsigned steps = argc > 1 ? atoi( argv[ 1 ] ) : 5000000 ;
+    unsigned depth = argc > 2 ? atoi( argv[ 2 ] ) : 16 ;
+    srand( 433 ) ;
+    unsigned long checksum = 0 ;
+
+    printf( "%-8s %12s %12s %12s\n" , "mix" , "scan ns" , "bitmap ns" , "queue ns" ) ;
+    for ( bool sparse : { true , false } )
+    {
+        std::vector<unsigned> mix = makeMix( sparse , steps + depth ) ;
+        double scan = timeTracker<ScanTop>( mix , depth , checksum ) ;
+        double bitmap = timeTracker<BitmapTop>( mix , depth , checksum ) ;
+        double queue = timeReadyQueue( mix , depth , checksum ) ;
+        printf( "%-8s %12.2f %12.2f %12.2f\n" , sparse ? "sparse" : "dense" , scan , bitmap , queue ) ;
+    }
+
+    // The whole queue across priority ranges, from one bitmap word up to a
+    // three-level bitmap.
+    printf( "\n%-8s %12s %12s\n" , "levels" , "sparse ns" , "dense ns" ) ;
+    double times[ 2 ] ;
+    for ( bool sparse : { true , false } )
+        times[ sparse ] = timeReadyQueue<64>( makeMix( sparse , steps + depth , 63 ) , depth , checksum ) ;
+    printf( "%-8u %12.2f %12.2f\n" , 64 , times[ 1 ] , times[ 0 ] ) ;
+    for ( bool sparse : { true , false } )
+        times[ sparse ] = timeReadyQueue<4096>( makeMix( sparse , steps + depth , 4095 ) , depth , checksum ) ;
+    printf( "%-8u %12.2f %12.2f\n" , 4096 , times[ 1 ] , times[ 0 ] ) ;
+    for ( bool sparse : { true , false } )
+        times[ sparse ] = timeReadyQueue<65536>( makeMix( sparse , steps + depth , 65535 ) , depth , checksum ) ;
+    printf( "%-8u %12.2f %12.2f\n" , 65536 , times[ 1 ] , times[ 0 ] ) ;
+
+    // Aging against no aging. Removal reads the top of the aging ring and
+    // of the capped lists, so the overhead should not grow with the cap.
+    printf( "\n%-8s %-8s %12s %12s\n" , "rate" , "cap" , "sparse ns" , "dense ns" ) ;
+    unsigned aging[][ 2 ] = { { 0 , 0 } , { 16 , 4 } , { 4 , 16 } , { 1 , MAX_PRIORITY } } ;
+    for ( auto & a : aging )
+    {
+        for ( bool sparse : { true , false } )
+            times[ sparse ] = timeReadyQueue( makeMix( sparse , steps + depth ) , depth , checksum , a[ 0 ] , a[ 1 ] ) ;
+        if ( a[ 0 ] == 0 )
+            printf( "%-8s %-8s %12.2f %12.2f\n" , "off" , "-" , times[ 1 ] , times[ 0 ] ) ;
+        else
+            printf( "%-8u %-8u %12.2f %12.2f\n" , a[ 0 ] , a[ 1 ] , times[ 1 ] , times[ 0 ] ) ;
+    }
+
+    // Printed so the timed loops cannot be optimized away.
+    printf( "checksum %lu\n" , checksum ) ;
+    return 0 ;
+}
@@ -0,0 +1,506 @@
+/**
+ * Assignment 1: priority queue of processes
+ * @file bench_suite.cpp
+ * @author Corey Talbert
+ * @brief Benchmark suite running add/remove mixes over several priority
+ * distributions and queue sizes against ReadyQueue and three baselines:
+ * std::priority_queue, a pairing heap and a radix heap, and against
+ * EDFReadyQueue, the deadline-ordered queue. Each run reports
+ * nanoseconds per operation, instructions per operation (from
+ * perf_event_open, when the kernel allows it) and peak resident memory.
+ *
+ * Usage: bench_suite [ops=N] [sizes=N,N,...] [dist=uniform,zipf,bimodal]
+ *                    [add=PERCENT] [queue=bucket,std,pairing,radix,edf]
+ * @version 0.1
+ * @date 09-19-2022
+ */
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <queue>
+#include <string>
+#include <vector>
+#include <sys/resource.h>
+#include <sys/wait.h>
+#include <unistd.h>
+#ifdef __linux__
+#include <linux/perf_event.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#endif
+#include "edf_readyqueue.h"
+#include "readyqueue.h"
+using namespace std::chrono ;
+
+/**
+ * @brief The key the heaps order PCBs by: higher priority first, then first
+ * in, first out, the same order as ReadyQueue.
+ * @param pcb The PCB.
+ * @param seq The number of PCBs added before it.
+ * @return uint64_t: the key, smallest first
+ */
+uint64_t heapKey( const PCB* pcb , uint64_t seq )
+{
+    return ( uint64_t( MAX_PRIORITY - pcb -> getPriority() ) << 40 ) | seq ;
+}
+
+/**
+ * @brief ReadyQueue, the bucket queue under test.
+ */
+struct BucketQueue
+{
+    ReadyQueue<> queue ;
+
+    void add( PCB* pcb ) { queue.addPCB( pcb ) ; }
+    PCB* remove() { return queue.removePCB() ; }
+} ;
+
+/**
+ * @brief A binary heap from the standard library.
+ */
+struct StdQueue
+{
+    struct Entry
+    {
+        uint64_t key ;
+        PCB* pcb ;
+        bool operator<( const Entry & other ) const { return key > other.key ; }
+    } ;
+    std::priority_queue<Entry> heap ;
+    uint64_t seq = 0 ;
+
+    void add( PCB* pcb ) { heap.push( Entry{ heapKey( pcb , seq++ ) , pcb } ) ; }
+
+    PCB* remove()
+    {
+        if ( heap.empty() )
+            return nullptr ;
+        PCB* pcb = heap.top().pcb ;
+        heap.pop() ;
+        return pcb ;
+    }
+} ;
+
+/**
+ * @brief A pairing heap with its nodes taken from a NodePool, and the
+ * two-pass merge on removal.
+ */
+struct PairingQueue
+{
+    struct Node
+    {
+        uint64_t key ;
+        PCB* pcb ;
+        Node* child = nullptr ;
+        Node* sibling = nullptr ;
+    } ;
+    NodePool<Node> pool ;
+    Node* root = nullptr ;
+    uint64_t seq = 0 ;
+    // Scratch space for the first merge pass, kept to avoid reallocating.
+    std::vector<Node*> pairs ;
+
+    static Node* meld( Node* a , Node* b )
+    {
+        if ( a == nullptr )
+            return b ;
+        if ( b == nullptr )
+            return a ;
+        if ( b -> key < a -> key )
+            std::swap( a , b ) ;
+        b -> sibling = a -> child ;
+        a -> child = b ;
+        return a ;
+    }
+
+    void add( PCB* pcb )
+    {
+        Node* node = pool.acquire() ;
+        node -> key = heapKey( pcb , seq++ ) ;
+        node -> pcb = pcb ;
+        root = meld( root , node ) ;
+    }
+
+    PCB* remove()
+    {
+        if ( root == nullptr )
+            return nullptr ;
+        Node* old = root ;
+        PCB* pcb = old -> pcb ;
+        // Meld the children in pairs from left to right, then meld the pairs
+        // together from right to left.
+        pairs.clear() ;
+        for ( Node* a = old -> child ; a ; )
+        {
+            Node* b = a -> sibling ;
+            Node* next = b ? b -> sibling : nullptr ;
+            a -> sibling = nullptr ;
+            if ( b )
+                b -> sibling = nullptr ;
+            pairs.push_back( meld( a , b ) ) ;
+            a = next ;
+        }
+        root = nullptr ;
+        for ( size_t i = pairs.size() ; i > 0 ; --i )
+            root = meld( root , pairs[ i - 1 ] ) ;
+        pool.release( old ) ;
+        return pcb ;
+    }
+} ;
+
+/**
+ * @brief A radix heap. It only accepts keys no smaller than the last key
+ * removed, so it runs the PCBs as virtual deadlines: a PCB's key is the last
+ * removed key plus its distance below MAX_PRIORITY. Higher priority PCBs
+ * still go first among those added together, but the order is not strict
+ * priority; the cost is what is being compared.
+ */
+struct RadixQueue
+{
+    struct Entry
+    {
+        uint64_t key ;
+        PCB* pcb ;
+    } ;
+    // Bucket i holds the keys whose highest bit differing from last is i - 1.
+    std::vector<Entry> buckets[ 65 ] ;
+    uint64_t last = 0 ;
+    size_t count = 0 ;
+
+    static unsigned bucketOf( uint64_t key , uint64_t last )
+    {
+        return key == last ? 0 : 64 - __builtin_clzll( key ^ last ) ;
+    }
+
+    void add( PCB* pcb )
+    {
+        uint64_t key = last + ( MAX_PRIORITY - pcb -> getPriority() ) ;
+        buckets[ bucketOf( key , last ) ].push_back( Entry{ key , pcb } ) ;
+        ++ count ;
+    }
+
+    PCB* remove()
+    {
+        if ( count == 0 )
+            return nullptr ;
+        if ( buckets[ 0 ].empty() )
+        {
+            // Move last up to the smallest key of the first non-empty bucket
+            // and spread that bucket out again; every entry moves lower.
+            unsigned i = 1 ;
+            while ( buckets[ i ].empty() )
+                ++ i ;
+            uint64_t smallest = buckets[ i ][ 0 ].key ;
+            for ( const Entry & e : buckets[ i ] )
+                smallest = std::min( smallest , e.key ) ;
+            last = smallest ;
+            for ( const Entry & e : buckets[ i ] )
+                buckets[ bucketOf( e.key , last ) ].push_back( e ) ;
+            buckets[ i ].clear() ;
+        }
+        PCB* pcb = buckets[ 0 ].back().pcb ;
+        buckets[ 0 ].pop_back() ;
+        -- count ;
+        return pcb ;
+    }
+} ;
+
+/**
+ * @brief Counts the instructions retired by this process in user mode.
+ * Reads zero when perf_event_open is unavailable or not permitted.
+ */
+class InstructionCounter
+{
+private:
+    int fd = -1 ;
+
+public:
+    InstructionCounter()
+    {
+#ifdef __linux__
+        perf_event_attr attr ;
+        memset( &attr , 0 , sizeof( attr ) ) ;
+        attr.type = PERF_TYPE_HARDWARE ;
+        attr.size = sizeof( attr ) ;
+        attr.config = PERF_COUNT_HW_INSTRUCTIONS ;
+        attr.disabled = 1 ;
+        attr.exclude_kernel = 1 ;
+        attr.exclude_hv = 1 ;
+        fd = syscall( __NR_perf_event_open , &attr , 0 , -1 , -1 , 0 ) ;
+#endif
+    }
+
+    ~InstructionCounter()
+    {
+        if ( fd >= 0 )
+            close( fd ) ;
+    }
+
+    bool available() const { return fd >= 0 ; }
+
+    void start()
+    {
+#ifdef __linux__
+        if ( fd >= 0 )
+        {
+            ioctl( fd , PERF_EVENT_IOC_RESET , 0 ) ;
+            ioctl( fd , PERF_EVENT_IOC_ENABLE , 0 ) ;
+        }
+#endif
+    }
+
+    uint64_t stop()
+    {
+        uint64_t count = 0 ;
+#ifdef __linux__
+        if ( fd >= 0 )
+        {
+            ioctl( fd , PERF_EVENT_IOC_DISABLE , 0 ) ;
+            if ( read( fd , &count , sizeof( count ) ) != sizeof( count ) )
+                count = 0 ;
+        }
+#endif
+        return count ;
+    }
+} ;
+
+/**
+ * @brief EDFReadyQueue, run like the radix heap: a PCB's deadline is the
+ * number of removals so far plus its distance below MAX_PRIORITY, so higher
+ * priority PCBs have nearer deadlines.
+ */
+struct EDFQueue
+{
+    EDFReadyQueue queue ;
+    uint64_t removed = 0 ;
+
+    void add( PCB* pcb ) { queue.addPCB( pcb , removed + ( MAX_PRIORITY - pcb -> getPriority() ) ) ; }
+
+    PCB* remove()
+    {
+        PCB* pcb = queue.removePCB() ;
+        if ( pcb )
+            ++ removed ;
+        return pcb ;
+    }
+} ;
+
+/**
+ * @brief Draws priorities from one of the distributions.
+ */
+class PriorityDistribution
+{
+private:
+    std::string name ;
+    // The cumulative weights of the priorities, for zipf.
+    std::vector<double> cdf ;
+
+public:
+    PriorityDistribution( const std::string & name ) : name( name )
+    {
+        // Zipf with exponent 1 over the priority range, rank 1 being
+        // MIN_PRIORITY: most processes are low priority, a few are high.
+        double total = 0 ;
+        for ( unsigned rank = 1 ; rank <= MAX_PRIORITY - MIN_PRIORITY + 1 ; ++rank )
+            cdf.push_back( total += 1.0 / rank ) ;
+        for ( double & c : cdf )
+            c /= total ;
+    }
+
+    bool valid() const
+    {
+        return name == "uniform" or name == "zipf" or name == "bimodal" ;
+    }
+
+    unsigned next() const
+    {
+        unsigned range = MAX_PRIORITY - MIN_PRIORITY + 1 ;
+        if ( name == "zipf" )
+        {
+            double u = ( double ) rand() / RAND_MAX ;
+            unsigned rank = std::lower_bound( cdf.begin() , cdf.end() , u ) - cdf.begin() ;
+            return MIN_PRIORITY + std::min( rank , range - 1 ) ;
+        }
+        if ( name == "bimodal" )
+        {
+            // Half interactive work near the top, half batch work near the
+            // bottom, each spread over a tenth of the range.
+            unsigned spread = range / 10 ;
+            return rand() % 2
+                ? MAX_PRIORITY - rand() % spread
+                : MIN_PRIORITY + rand() % spread ;
+        }
+        return MIN_PRIORITY + rand() % range ;
+    }
+} ;
+
+/**
+ * @brief The settings of the suite.
+ */
+struct Config
+{
+    unsigned long ops = 1000000 ;
+    std::vector<unsigned long> sizes = { 1000 , 100000 , 1000000 } ;
+    std::vector<std::string> dists = { "uniform" , "zipf" , "bimodal" } ;
+    std::vector<std::string> queues = { "bucket" , "std" , "pairing" , "radix" , "edf" } ;
+    // The percentage of operations that are adds; the rest are removals.
+    unsigned add = 50 ;
+} ;
+
+/**
+ * @brief Prefill a queue to size PCBs, then time ops adds and removals and
+ * print one row of results. Removals from an empty queue become adds.
+ */
+template <class Queue>
+void runOne( const Config & config , const std::string & queue_name ,
+             const std::string & dist_name , unsigned long size )
+{
+    PriorityDistribution dist( dist_name ) ;
+    // Everything random is drawn before timing starts. Every add uses a
+    // fresh PCB, so there are at most size + ops of them.
+    std::vector<PCB> pcbs( size + config.ops ) ;
+    for ( unsigned long i = 0 ; i < pcbs.size() ; ++i )
+        pcbs[ i ] = PCB( i , dist.next() ) ;
+    std::vector<bool> is_add( config.ops ) ;
+    for ( unsigned long i = 0 ; i < config.ops ; ++i )
+        is_add[ i ] = ( unsigned ) rand() % 100 < config.add ;
+
+    Queue* queue = new Queue ;
+    unsigned long next = 0 ;
+    for ( ; next < size ; ++next )
+        queue -> add( &pcbs[ next ] ) ;
+
+    unsigned long checksum = 0 ;
+    InstructionCounter counter ;
+    high_resolution_clock::time_point start = high_resolution_clock::now() ;
+    counter.start() ;
+    for ( unsigned long i = 0 ; i < config.ops ; ++i )
+    {
+        PCB* pcb = is_add[ i ] ? nullptr : queue -> remove() ;
+        if ( pcb )
+            checksum += pcb -> getPriority() ;
+        else
+            queue -> add( &pcbs[ next++ ] ) ;
+    }
+    uint64_t instructions = counter.stop() ;
+    high_resolution_clock::time_point end = high_resolution_clock::now() ;
+
+    rusage usage ;
+    getrusage( RUSAGE_SELF , &usage ) ;
+    char instr[ 32 ] = "n/a" ;
+    if ( counter.available() )
+        snprintf( instr , sizeof( instr ) , "%.1f" , ( double ) instructions / config.ops ) ;
+    printf( "%-8s %-8s %10lu %10.2f %10s %12ld %12lu\n" , queue_name.c_str() , dist_name.c_str() ,
+            size , duration<double, std::nano>( end - start ).count() / config.ops , instr ,
+            usage.ru_maxrss , checksum ) ;
+    fflush( stdout ) ;
+    delete queue ;
+}
+
+/**
+ * @brief Run one benchmark in a child process, so its peak RSS is its own.
+ */
+void runIsolated( const Config & config , const std::string & queue_name ,
+                  const std::string & dist_name , unsigned long size )
+{
+    fflush( stdout ) ;
+    pid_t pid = fork() ;
+    if ( pid == 0 )
+    {
+        if ( queue_name == "bucket" )
+            runOne<BucketQueue>( config , queue_name , dist_name , size ) ;
+        else if ( queue_name == "std" )
+            runOne<StdQueue>( config , queue_name , dist_name , size ) ;
+        else if ( queue_name == "pairing" )
+            runOne<PairingQueue>( config , queue_name , dist_name , size ) ;
+        else if ( queue_name == "radix" )
+            runOne<RadixQueue>( config , queue_name , dist_name , size ) ;
+        else if ( queue_name == "edf" )
+            runOne<EDFQueue>( config , queue_name , dist_name , size ) ;
+        else
+            printf( "%-8s unknown queue\n" , queue_name.c_str() ) ;
+        _exit( 0 ) ;
+    }
+    if ( pid < 0 )
+    {
+        perror( "fork" ) ;
+        return ;
+    }
+    int status ;
+    waitpid( pid , &status , 0 ) ;
+    if ( not WIFEXITED( status ) or WEXITSTATUS( status ) != 0 )
+        printf( "%-8s %-8s %10lu failed\n" , queue_name.c_str() , dist_name.c_str() , size ) ;
+}
+
+/**
+ * @brief Split a comma-separated list.
+ */
+std::vector<std::string> splitList( const std::string & list )
+{
+    std::vector<std::string> items ;
+    size_t begin = 0 ;
+    while ( begin <= list.size() )
+    {
+        size_t end = list.find( ',' , begin ) ;
+        if ( end == std::string::npos )
+            end = list.size() ;
+        if ( end > begin )
+            items.push_back( list.substr( begin , end - begin ) ) ;
+        begin = end + 1 ;
+    }
+    return items ;
+}
+
+int main( int argc , char * argv[] )
+{
+    Config config ;
+    for ( int i = 1 ; i < argc ; ++i )
+    {
+        std::string arg = argv[ i ] ;
+        size_t eq = arg.find( '=' ) ;
+        std::string key = arg.substr( 0 , eq ) ;
+        std::string value = eq == std::string::npos ? "" : arg.substr( eq + 1 ) ;
+        if ( key == "ops" )
+            config.ops = strtoul( value.c_str() , NULL , 10 ) ;
+        else if ( key == "sizes" )
+        {
+            config.sizes.clear() ;
+            for ( const std::string & s : splitList( value ) )
+                config.sizes.push_back( strtoul( s.c_str() , NULL , 10 ) ) ;
+        }
+        else if ( key == "dist" )
+            config.dists = splitList( value ) ;
+        else if ( key == "queue" )
+            config.queues = splitList( value ) ;
+        else if ( key == "add" )
+            config.add = std::min( 100ul , strtoul( value.c_str() , NULL , 10 ) ) ;
+        else
+        {
+            fprintf( stderr , "usage: %s [ops=N] [sizes=N,N,...] [dist=uniform,zipf,bimodal] "
+                              "[add=PERCENT] [queue=bucket,std,pairing,radix,edf]\n" , argv[ 0 ] ) ;
+            return 1 ;
+        }
+    }
+    for ( const std::string & d : config.dists )
+    {
+        if ( not PriorityDistribution( d ).valid() )
+        {
+            fprintf( stderr , "unknown distribution %s\n" , d.c_str() ) ;
+            return 1 ;
+        }
+    }
+
+    srand( 433 ) ;
+    printf( "%lu operations, %u%% adds\n" , config.ops , config.add ) ;
+    printf( "%-8s %-8s %10s %10s %10s %12s %12s\n" , "queue" , "dist" , "size" ,
+            "ns/op" , "instr/op" , "peak RSS KB" , "checksum" ) ;
+    for ( const std::string & dist : config.dists )
+        for ( unsigned long size : config.sizes )
+            for ( const std::string & queue : config.queues )
+                runIsolated( config , queue , dist , size ) ;
+    return 0 ;
+}
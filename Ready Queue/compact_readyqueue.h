@@ -0,0 +1,287 @@
+/**
+ * Assignment 1: priority queue of processes
+ * @file compact_readyqueue.h
+ * @author Corey Talbert
+ * @brief CompactReadyQueue is the ReadyQueue over a CompactPCBTable. Its lists
+ * are chained through the 32-bit links of the 16-byte hot records, so it
+ * allocates nothing and walks four PCBs per cache line.
+ * @version 0.1
+ * @date 09-19-2022
+ */
+
+#pragma once
+#include "compactpcb.h"
+#include "prioritybitmap.h"
+
+/**
+ * @brief A priority queue of the PCBs of a CompactPCBTable, referred to by
+ * ID. PCBs of equal priority are removed in FIFO order.
+ * @tparam LEVELS The number of priority levels. PCB priorities must be less
+ * than LEVELS.
+ */
+template <unsigned LEVELS = MAX_PRIORITY + 1>
+class CompactReadyQueue
+{
+private:
+    /**
+     * @brief The table holding the PCBs and their links.
+     */
+    CompactPCBTable& table ;
+
+    /**
+     * @brief The first and last ID of each priority list, or PCB_NIL.
+     */
+    uint32_t head[ LEVELS ] ;
+    uint32_t tail[ LEVELS ] ;
+
+    /**
+     * @brief Bit p is set exactly when the list of priority p is non-empty.
+     */
+    PriorityBitmap<LEVELS> occupancy ;
+
+    /**
+     * @brief The highest priority non-empty list.
+     */
+    unsigned top = 0 ;
+
+    /**
+     * @brief The number of PCBs in the queue.
+     */
+    unsigned rq_size = 0 ;
+
+    /**
+     * @brief The number of PCBs removePCB has dispatched, the clock
+     * PCBCold::enqueued_at is kept in.
+     */
+    unsigned long clock = 0 ;
+
+    /**
+     * @brief Unlink a queued PCB from its list, keeping the bitmap, top and
+     * size up to date.
+     * @param id: the ID of the PCB
+     */
+    void detach( const uint32_t& id ) ;
+
+public:
+    /**
+     * @brief Construct an empty queue of the PCBs in a table.
+     * @param table: the table, which must outlive the queue
+     */
+    CompactReadyQueue( CompactPCBTable& table ) ;
+
+    /**
+     * @brief Add a PCB to the back of its priority list, stamping its cold
+     * record with the time it was queued.
+     * @param id: the ID of the PCB
+     * @return bool: true if the PCB was added, false if the ID is out of
+     * range, released or already queued, in which case nothing was done
+     */
+    bool addPCB( const uint32_t& id ) ;
+
+    /**
+     * @brief Remove and return the PCB with the highest priority, counting
+     * the dispatch in its cold record.
+     * @return uint32_t: the ID of the PCB, or PCB_NIL if the queue is empty
+     */
+    uint32_t removePCB() ;
+
+    /**
+     * @brief Remove a PCB from anywhere in the queue in O(1).
+     * @param id: the ID of the PCB
+     * @return bool: true if the PCB was removed, false if it was not queued
+     */
+    bool remove( const uint32_t& id ) ;
+
+    /**
+     * @brief Change the priority of a PCB in O(1). A queued PCB moves to the
+     * back of its new priority list but keeps the time it was queued.
+     * @param id: the ID of the PCB
+     * @param priority: the new priority
+     * @return bool: true if the PCB was queued
+     */
+    bool changePriority( const uint32_t& id , const unsigned& priority ) ;
+
+    /**
+     * @brief Returns the number of elements in the queue.
+     * @return int: the number of PCBs in the queue
+     */
+    int size() const ;
+
+    /**
+     * @brief Get the priority of the PCB that removePCB would return next.
+     * @return unsigned: the highest priority in the queue, or 0 if it is empty
+     */
+    unsigned topPriority() const ;
+
+    /**
+     * @brief Display the PCBs in the queue.
+     */
+    void displayAll() const ;
+} ;
+
+/**
+ * @brief Construct an empty queue of the PCBs in a table.
+ * @param table: the table, which must outlive the queue
+ */
+template <unsigned LEVELS>
+CompactReadyQueue<LEVELS>::CompactReadyQueue( CompactPCBTable& table )
+    : table( table )
+{
+    for ( unsigned p = 0 ; p < LEVELS ; ++p )
+        this -> head[ p ] = this -> tail[ p ] = PCB_NIL ;
+}
+
+/**
+ * @brief Add a PCB to the back of its priority list, stamping its cold
+ * record with the time it was queued.
+ * @param id: the ID of the PCB
+ * @return bool: true if the PCB was added, false if the ID is out of
+ * range, released or already queued, in which case nothing was done
+ */
+template <unsigned LEVELS>
+bool CompactReadyQueue<LEVELS>::addPCB( const uint32_t& id )
+{
+    // A queued record would be appended twice, leaving its old neighbours
+    // linked to it, and a free record's next is the free list.
+    if ( id >= this -> table . capacity()
+        or this -> table . getHot( id ) . flags & ( PCBHot::FREE | PCBHot::QUEUED ) )
+        return false ;
+    PCBHot& pcb = this -> table . getHot( id ) ;
+    unsigned p = pcb . priority ;
+    pcb . setState( ProcState::READY ) ;
+    pcb . flags |= PCBHot::QUEUED ;
+    pcb . next = PCB_NIL ;
+    pcb . prev = this -> tail[ p ] ;
+    if ( this -> tail[ p ] == PCB_NIL )
+        this -> head[ p ] = id ;
+    else
+        this -> table . getHot( this -> tail[ p ] ) . next = id ;
+    this -> tail[ p ] = id ;
+    this -> table . getCold( id ) . enqueued_at = this -> clock ;
+    this -> occupancy . set( p ) ;
+    ++ this -> rq_size ;
+    if ( this -> top < p )
+        this -> top = p ;
+    return true ;
+}
+
+/**
+ * @brief Remove and return the PCB with the highest priority, counting
+ * the dispatch in its cold record.
+ * @return uint32_t: the ID of the PCB, or PCB_NIL if the queue is empty
+ */
+template <unsigned LEVELS>
+uint32_t CompactReadyQueue<LEVELS>::removePCB()
+{
+    if ( this -> rq_size == 0 )
+        return PCB_NIL ;
+    uint32_t id = this -> head[ this -> top ] ;
+    this -> detach( id ) ;
+    this -> table . getHot( id ) . setState( ProcState::RUNNING ) ;
+    ++ this -> table . getCold( id ) . dispatches ;
+    ++ this -> clock ;
+    return id ;
+}
+
+/**
+ * @brief Remove a PCB from anywhere in the queue in O(1).
+ * @param id: the ID of the PCB
+ * @return bool: true if the PCB was removed, false if it was not queued
+ */
+template <unsigned LEVELS>
+bool CompactReadyQueue<LEVELS>::remove( const uint32_t& id )
+{
+    if ( not ( this -> table . getHot( id ) . flags & PCBHot::QUEUED ) )
+        return false ;
+    this -> detach( id ) ;
+    return true ;
+}
+
+/**
+ * @brief Change the priority of a PCB in O(1). A queued PCB moves to the
+ * back of its new priority list but keeps the time it was queued.
+ * @param id: the ID of the PCB
+ * @param priority: the new priority
+ * @return bool: true if the PCB was queued
+ */
+template <unsigned LEVELS>
+bool CompactReadyQueue<LEVELS>::changePriority( const uint32_t& id , const unsigned& priority )
+{
+    bool queued = this -> remove( id ) ;
+    this -> table . getHot( id ) . priority = priority ;
+    if ( queued )
+    {
+        unsigned long enqueued_at = this -> table . getCold( id ) . enqueued_at ;
+        this -> addPCB( id ) ;
+        this -> table . getCold( id ) . enqueued_at = enqueued_at ;
+    }
+    return queued ;
+}
+
+/**
+ * @brief Unlink a queued PCB from its list, keeping the bitmap, top and
+ * size up to date.
+ * @param id: the ID of the PCB
+ */
+template <unsigned LEVELS>
+void CompactReadyQueue<LEVELS>::detach( const uint32_t& id )
+{
+    PCBHot& pcb = this -> table . getHot( id ) ;
+    unsigned p = pcb . priority ;
+    // Bridge the neighbours over the PCB, or move head or tail past it.
+    if ( pcb . prev == PCB_NIL )
+        this -> head[ p ] = pcb . next ;
+    else
+        this -> table . getHot( pcb . prev ) . next = pcb . next ;
+    if ( pcb . next == PCB_NIL )
+        this -> tail[ p ] = pcb . prev ;
+    else
+        this -> table . getHot( pcb . next ) . prev = pcb . prev ;
+    pcb . next = pcb . prev = PCB_NIL ;
+    pcb . flags &= ~PCBHot::QUEUED ;
+    -- this -> rq_size ;
+    if ( this -> head[ p ] == PCB_NIL )
+    {
+        this -> occupancy . clear( p ) ;
+        if ( p == this -> top )
+            this -> top = this -> occupancy . empty() ? 0 : this -> occupancy . highest() ;
+    }
+}
+
+/**
+ * @brief Returns the number of elements in the queue.
+ * @return int: the number of PCBs in the queue
+ */
+template <unsigned LEVELS>
+int CompactReadyQueue<LEVELS>::size() const
+{
+    return this -> rq_size ;
+}
+
+/**
+ * @brief Get the priority of the PCB that removePCB would return next.
+ * @return unsigned: the highest priority in the queue, or 0 if it is empty
+ */
+template <unsigned LEVELS>
+unsigned CompactReadyQueue<LEVELS>::topPriority() const
+{
+    return this -> top ;
+}
+
+/**
+ * @brief Display the PCBs in the queue.
+ */
+template <unsigned LEVELS>
+void CompactReadyQueue<LEVELS>::displayAll() const
+{
+    puts("Display Processes in ReadyQueue:") ;
+    for ( unsigned i = LEVELS - 1 ; i >= MIN_PRIORITY ; --i )
+    {
+        for ( uint32_t id = this -> head[ i ] ; id != PCB_NIL ; id = this -> table . getHot( id ) . next )
+        {
+            putchar('\t') ;
+            this -> table . display( id ) ;
+            putchar('\n') ;
+        }
+    }
+}
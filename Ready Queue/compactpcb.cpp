@@ -0,0 +1,111 @@
+/**
+ * Assignment 1: priority queue of processes
+ * @file compactpcb.cpp
+ * @author Corey Talbert
+ * @brief This is the implementation file for the CompactPCBTable class.
+ * @date 09-19-2022
+ */
+
+#include "compactpcb.h"
+
+/**
+ * @brief Construct a table with room for size PCBs.
+ * @param size: the initial capacity
+ */
+CompactPCBTable::CompactPCBTable( const unsigned& size )
+{
+    this -> grow( size ) ;
+}
+
+/**
+ * @brief Add n free records to the end of the table.
+ * @param n The number of records.
+ */
+void CompactPCBTable::grow( const unsigned& n )
+{
+    uint32_t first = this -> hot . size() ;
+    this -> hot . resize( first + n ) ;
+    this -> cold . resize( first + n ) ;
+    // Thread the new records onto the free list in increasing order, so
+    // fresh IDs come out in order.
+    for ( uint32_t id = first + n ; id > first ; --id )
+    {
+        this -> hot[ id - 1 ] . id = id - 1 ;
+        this -> hot[ id - 1 ] . flags = PCBHot::FREE ;
+        this -> hot[ id - 1 ] . next = this -> free_list ;
+        this -> free_list = id - 1 ;
+    }
+}
+
+/**
+ * @brief Create a PCB at a free ID, growing the table if it is full.
+ * @param priority: the priority of the new PCB
+ * @return uint32_t: the ID of the new PCB
+ */
+uint32_t CompactPCBTable::allocate( const unsigned& priority )
+{
+    if ( this -> free_list == PCB_NIL )
+        this -> grow( this -> hot . empty() ? 1 : this -> hot . size() ) ;
+    uint32_t id = this -> free_list ;
+    PCBHot& record = this -> hot[ id ] ;
+    this -> free_list = record . next ;
+    record . priority = priority ;
+    record . state = uint8_t( ProcState::NEW ) ;
+    record . flags = 0 ;
+    record . next = record . prev = PCB_NIL ;
+    this -> cold[ id ] = PCBCold() ;
+    ++ this -> live ;
+    return id ;
+}
+
+/**
+ * @brief Free the PCB with the given ID. It must not be queued.
+ * @param id: the ID
+ * @return bool: true if the PCB was freed, false if the ID is past the
+ * end of the table, already free or still queued
+ */
+bool CompactPCBTable::release( const uint32_t& id )
+{
+    // Releasing a free record again would put it on the free list twice,
+    // and allocate would then hand its ID out to two PCBs. A queued record
+    // would be linked into a ready queue and the free list at once.
+    if ( id >= this -> hot . size()
+        or this -> hot[ id ] . flags & ( PCBHot::FREE | PCBHot::QUEUED ) )
+        return false ;
+    PCBHot& record = this -> hot[ id ] ;
+    record . state = uint8_t( ProcState::TERMINATED ) ;
+    record . flags = PCBHot::FREE ;
+    record . next = this -> free_list ;
+    this -> free_list = id ;
+    -- this -> live ;
+    return true ;
+}
+
+/**
+ * @brief Get the number of records in the table.
+ * @return unsigned: the capacity of the table
+ */
+unsigned CompactPCBTable::capacity() const
+{
+    return this -> hot . size() ;
+}
+
+/**
+ * @brief Get the number of allocated PCBs.
+ * @return unsigned: the number of PCBs
+ */
+unsigned CompactPCBTable::size() const
+{
+    return this -> live ;
+}
+
+/**
+ * @brief Print a PCB. Kept out of line, away from the hot data.
+ * @param id: the ID
+ */
+void CompactPCBTable::display( const uint32_t& id ) const
+{
+    const PCBHot& record = this -> hot[ id ] ;
+    // The same format as PCB::display.
+    PCB( record . id , record . priority , record . getState() ) . display() ;
+}
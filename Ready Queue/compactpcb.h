@@ -0,0 +1,170 @@
+/**
+ * Assignment 1: priority queue of processes
+ * @file compactpcb.h
+ * @author Corey Talbert
+ * @brief A compact layout of the PCB for queues that scan many of them. The
+ * fields touched on every enqueue and dequeue are packed into a 16-byte hot
+ * record, four to a cache line, and everything else lives in a parallel cold
+ * side table. Records link to each other by index instead of by pointer.
+ * @version 0.1
+ * @date 09-19-2022
+ */
+
+#pragma once
+#include <cstdint>
+#include <vector>
+#include "pcb.h"
+
+/**
+ * @brief The index that links to no record.
+ */
+const uint32_t PCB_NIL = UINT32_MAX ;
+
+/**
+ * @brief The hot part of a PCB: what a ready queue reads when it adds,
+ * removes or scans PCBs.
+ */
+struct PCBHot
+{
+    // The unique process ID, which is also the index of the record.
+    uint32_t id = 0 ;
+    // The priority of the process. Larger number represents higher priority.
+    uint16_t priority = MIN_PRIORITY ;
+    // The ProcState of the process.
+    uint8_t state = uint8_t( ProcState::NEW ) ;
+    // PCBHot::QUEUED, PCBHot::FREE and any future flag bits.
+    uint8_t flags = 0 ;
+    // The next and previous records in the same ready queue list, or
+    // PCB_NIL. While the record is free, next links the table's free list.
+    uint32_t next = PCB_NIL ;
+    uint32_t prev = PCB_NIL ;
+
+    /**
+     * @brief Set in flags while the record is in a ready queue.
+     */
+    static const uint8_t QUEUED = 1 ;
+
+    /**
+     * @brief Set in flags while the record is on the table's free list.
+     */
+    static const uint8_t FREE = 2 ;
+
+    /**
+     * @brief Get the state of the PCB.
+     * @return ProcState: the state of the PCB
+     */
+    ProcState getState() const { return ProcState( this -> state ) ; }
+
+    /**
+     * @brief Change the state of the PCB.
+     * @param new_state
+     */
+    void setState( const ProcState& new_state ) { this -> state = uint8_t( new_state ) ; }
+} ;
+
+static_assert( sizeof( PCBHot ) == 16 , "PCBHot must stay at 16 bytes" ) ;
+
+/**
+ * @brief The cold part of a PCB: bookkeeping read rarely, kept out of the hot
+ * records' cache lines. CompactReadyQueue keeps both fields.
+ */
+struct PCBCold
+{
+    // When the PCB was last queued, in dispatches of the queue it is in.
+    unsigned long enqueued_at = 0 ;
+    // The number of times the PCB has been dispatched.
+    unsigned long dispatches = 0 ;
+} ;
+
+/**
+ * @brief A table of compact PCBs held as two parallel arrays, hot and cold,
+ * indexed by process ID. IDs are allocated and recycled in O(1) through a
+ * free list threaded through the free hot records. The table grows
+ * geometrically; records move when it does, so they are referred to by ID,
+ * never by pointer or reference across an allocate().
+ */
+class CompactPCBTable
+{
+private:
+    /**
+     * @brief The hot records, contiguous, four to a cache line.
+     */
+    std::vector<PCBHot> hot ;
+
+    /**
+     * @brief The cold records, parallel to hot.
+     */
+    std::vector<PCBCold> cold ;
+
+    /**
+     * @brief The first free record, or PCB_NIL.
+     */
+    uint32_t free_list = PCB_NIL ;
+
+    /**
+     * @brief The number of allocated records.
+     */
+    unsigned live = 0 ;
+
+    /**
+     * @brief Add n free records to the end of the table.
+     * @param n The number of records.
+     */
+    void grow( const unsigned& n ) ;
+
+public:
+    /**
+     * @brief Construct a table with room for size PCBs.
+     * @param size: the initial capacity
+     */
+    CompactPCBTable( const unsigned& size = 100 ) ;
+
+    /**
+     * @brief Create a PCB at a free ID, growing the table if it is full.
+     * @param priority: the priority of the new PCB
+     * @return uint32_t: the ID of the new PCB
+     */
+    uint32_t allocate( const unsigned& priority = MIN_PRIORITY ) ;
+
+    /**
+     * @brief Free the PCB with the given ID. It must not be queued.
+     * @param id: the ID
+     * @return bool: true if the PCB was freed, false if the ID is past the
+     * end of the table, already free or still queued
+     */
+    bool release( const uint32_t& id ) ;
+
+    /**
+     * @brief Get the hot record of a PCB.
+     * @param id: the ID
+     * @return PCBHot&: the record, valid until the next allocate()
+     */
+    PCBHot& getHot( const uint32_t& id ) { return this -> hot[ id ] ; }
+    const PCBHot& getHot( const uint32_t& id ) const { return this -> hot[ id ] ; }
+
+    /**
+     * @brief Get the cold record of a PCB.
+     * @param id: the ID
+     * @return PCBCold&: the record, valid until the next allocate()
+     */
+    PCBCold& getCold( const uint32_t& id ) { return this -> cold[ id ] ; }
+    const PCBCold& getCold( const uint32_t& id ) const { return this -> cold[ id ] ; }
+
+    /**
+     * @brief Get the number of records in the table.
+     * @return unsigned: the capacity of the table
+     */
+    unsigned capacity() const ;
+
+    /**
+     * @brief Get the number of allocated PCBs.
+     * @return unsigned: the number of PCBs
+     */
+    unsigned size() const ;
+
+    /**
+     * @brief Print a PCB. Kept out of line, away from the hot data.
+     * @param id: the ID
+     */
+    void display( const uint32_t& id ) const ;
+} ;
@@ -0,0 +1,91 @@
+/**
+ * Assignment 1: priority queue of processes
+ * @file concurrent_readyqueue.cpp
+ * @author Corey Talbert
+ * @brief Implementation of concurrent_readyqueue.h as a bucket queue with a
+ * mutex per bucket and an atomic occupancy bitmap.
+ * @date 09-19-2022
+ */
+#include "concurrent_readyqueue.h"
+
+/**
+ * @brief Construct an empty queue.
+ */
+ConcurrentReadyQueue::ConcurrentReadyQueue()
+    : occupancy( 0 ) , rq_size( 0 )
+{
+    for ( Bucket& b : this -> rq )
+        pthread_mutex_init( &b . mutex , NULL ) ;
+}
+
+/**
+ * @brief Destructor
+ */
+ConcurrentReadyQueue::~ConcurrentReadyQueue()
+{
+    for ( Bucket& b : this -> rq )
+    {
+        b . list . clear( b . pool ) ;
+        pthread_mutex_destroy( &b . mutex ) ;
+    }
+}
+
+/**
+ * @brief Add a PCB representing a process into the ready queue.
+ * @param pcbPtr: the pointer to the PCB to be added
+ */
+void ConcurrentReadyQueue::addPCB( PCB* pcbPtr )
+{
+    pcbPtr -> setState( ProcState::READY ) ;
+    unsigned new_priority = pcbPtr -> getPriority() ;
+    Bucket& b = this -> rq[ new_priority ] ;
+    pthread_mutex_lock( &b . mutex ) ;
+    b . list . append( pcbPtr , b . pool ) ;
+    // The first PCB of a level makes the level visible to removers.
+    if ( b . list . getSize() == 1 )
+        this -> occupancy . fetch_or( uint64_t( 1 ) << new_priority ) ;
+    pthread_mutex_unlock( &b . mutex ) ;
+    ++ this -> rq_size ;
+}
+
+/**
+ * @brief Remove and return the PCB with the highest priority from the queue
+ * @return PCB*: the pointer to the PCB with the highest priority, or
+ * nullptr if the queue is empty
+ */
+PCB* ConcurrentReadyQueue::removePCB()
+{
+    for ( ;; )
+    {
+        uint64_t bits = this -> occupancy . load() ;
+        if ( bits == 0 )
+            return nullptr ;
+        // The highest set bit is the highest priority non-empty level.
+        unsigned top = 63 - __builtin_clzll( bits ) ;
+        Bucket& b = this -> rq[ top ] ;
+        pthread_mutex_lock( &b . mutex ) ;
+        PCB* result = b . list . popFront( b . pool ) ;
+        // The last PCB of a level hides the level from removers.
+        if ( result != nullptr and b . list . isEmpty() )
+            this -> occupancy . fetch_and( ~( uint64_t( 1 ) << top ) ) ;
+        pthread_mutex_unlock( &b . mutex ) ;
+        if ( result != nullptr )
+        {
+            -- this -> rq_size ;
+            result -> setState( ProcState::RUNNING ) ;
+            return result ;
+        }
+        // Another thread emptied the level between reading the bitmap and
+        // taking the lock. Its bit is already clear, so read it again.
+    }
+}
+
+/**
+ * @brief Returns the number of elements in the queue. While other threads
+ * are adding or removing, the count may already be out of date.
+ * @return int: the number of PCBs in the queue
+ */
+int ConcurrentReadyQueue::size() const
+{
+    return this -> rq_size . load() ;
+}
@@ -0,0 +1,94 @@
+/**
+ * Assignment 1: priority queue of processes
+ * @file concurrent_readyqueue.h
+ * @author Corey Talbert
+ * @brief ConcurrentReadyQueue is a ReadyQueue that several dispatcher threads
+ * can add to and remove from at once, with a lock per priority level instead
+ * of one lock around the whole queue.
+ * @version 0.1
+ * @date 09-19-2022
+ */
+
+#pragma once
+#include <atomic>
+#include <cstdint>
+#include <pthread.h>
+#include "pcblist.h"
+
+/**
+ * @brief A thread-safe bucket queue of PCB's in the READY state. Each priority
+ * level has its own list, node pool and mutex, and an atomic occupancy bitmap
+ * tells removers which level is the highest non-empty one. PCBs of equal
+ * priority are removed in FIFO order, and a remove never returns a PCB while a
+ * higher priority one was already in the queue when the remove began.
+ */
+class ConcurrentReadyQueue
+{
+private:
+
+    /**
+     * @brief One priority level. Aligned to a cache line so threads working
+     * on neighbouring levels do not share lines.
+     */
+    struct alignas( 64 ) Bucket
+    {
+        // Guards list and pool.
+        pthread_mutex_t mutex ;
+        // The PCBs of this priority in FIFO order.
+        PCBList list ;
+        // The pool the list nodes come from.
+        PCBList::Pool pool ;
+    } ;
+
+    /**
+     * @brief The table of priority levels, one bigger than MAX_PRIORITY for
+     * ease of indexing.
+     */
+    Bucket rq[ MAX_PRIORITY + 1 ] ;
+
+    /**
+     * @brief Bit p is set exactly when rq[ p ] is non-empty. A bit is only
+     * changed while holding the mutex of its bucket.
+     */
+    std::atomic<uint64_t> occupancy ;
+    static_assert( MAX_PRIORITY < 64 , "occupancy bitmap holds one bit per priority" ) ;
+
+    /**
+     * @brief The number of PCB pointers in the queue.
+     */
+    std::atomic<int> rq_size ;
+
+public:
+    /**
+     * @brief Construct an empty queue.
+     */
+    ConcurrentReadyQueue() ;
+
+    /**
+     * @brief Destructor
+     */
+    ~ConcurrentReadyQueue() ;
+
+    ConcurrentReadyQueue( const ConcurrentReadyQueue& ) = delete ;
+    ConcurrentReadyQueue& operator=( const ConcurrentReadyQueue& ) = delete ;
+
+    /**
+     * @brief Add a PCB representing a process into the ready queue.
+     * @param pcbPtr: the pointer to the PCB to be added
+     */
+    void addPCB( PCB* pcbPtr ) ;
+
+    /**
+     * @brief Remove and return the PCB with the highest priority from the queue
+     * @return PCB*: the pointer to the PCB with the highest priority, or
+     * nullptr if the queue is empty
+     */
+    PCB* removePCB() ;
+
+    /**
+     * @brief Returns the number of elements in the queue. While other threads
+     * are adding or removing, the count may already be out of date.
+     * @return int: the number of PCBs in the queue
+     */
+    int size() const ;
+} ; // End of class ConcurrentReadyQueue
@@ -0,0 +1,257 @@
+/**
+ * Assignment 1: priority queue of processes
+ * @file edf_readyqueue.cpp
+ * @author Corey Talbert
+ * @brief Implementation of edf_readyqueue.h as a 4-ary heap with a position
+ * index.
+ * @date 09-19-2022
+ */
+
+#include <cstdio>
+#include "edf_readyqueue.h"
+
+// Taken by reference in addPCB, so they need a definition.
+const unsigned EDFReadyQueue::NOT_QUEUED ;
+const unsigned EDFReadyQueue::DENSE_SLACK ;
+
+/**
+ * @brief Construct an empty queue.
+ */
+EDFReadyQueue::EDFReadyQueue() : sparse_position( NOT_QUEUED ) {}
+
+/**
+ * @brief Destructor. The PCBs are not owned and are left alone.
+ */
+EDFReadyQueue::~EDFReadyQueue() {}
+
+/**
+ * @brief Store an entry at a heap index and record its position.
+ */
+void EDFReadyQueue::place( const unsigned& i , const Entry& entry )
+{
+    this -> heap[ i ] = entry ;
+    unsigned id = entry . pcb -> getID() ;
+    if ( id < this -> position . size() )
+        this -> position[ id ] = i ;
+    else
+        this -> sparse_position . set( id , i ) ;
+}
+
+/**
+ * @brief Get the recorded heap index of a PCB ID. A PCB added while
+ * position was too short for its ID may have been moved into position since
+ * by a sift, so position is checked first.
+ * @param id: the ID
+ * @return unsigned: the index, or NOT_QUEUED
+ */
+unsigned EDFReadyQueue::positionOf( const unsigned& id ) const
+{
+    if ( id < this -> position . size() and this -> position[ id ] != NOT_QUEUED )
+        return this -> position[ id ] ;
+    return this -> sparse_position . get( id ) ;
+}
+
+/**
+ * @brief Move an entry up from index i until its parent comes before it.
+ * Parents are shifted down into the hole rather than swapped.
+ * @param i: the index of the hole the entry goes in
+ * @param entry: the entry
+ */
+void EDFReadyQueue::siftUp( unsigned i , const Entry& entry )
+{
+    while ( i > 0 )
+    {
+        unsigned parent = ( i - 1 ) / ARITY ;
+        if ( not before( entry , this -> heap[ parent ] ) )
+            break ;
+        this -> place( i , this -> heap[ parent ] ) ;
+        i = parent ;
+    }
+    this -> place( i , entry ) ;
+}
+
+/**
+ * @brief Move an entry down from index i until it comes before all of
+ * its children. Children are shifted up into the hole rather than swapped.
+ * @param i: the index of the hole the entry goes in
+ * @param entry: the entry
+ */
+void EDFReadyQueue::siftDown( unsigned i , const Entry& entry )
+{
+    unsigned n = this -> heap . size() ;
+    for ( ;; )
+    {
+        unsigned first = ARITY * i + 1 ;
+        if ( first >= n )
+            break ;
+        unsigned last = first + ARITY < n ? first + ARITY : n ;
+        unsigned best = first ;
+        for ( unsigned c = first + 1 ; c < last ; ++c )
+            if ( before( this -> heap[ c ] , this -> heap[ best ] ) )
+                best = c ;
+        if ( not before( this -> heap[ best ] , entry ) )
+            break ;
+        this -> place( i , this -> heap[ best ] ) ;
+        i = best ;
+    }
+    this -> place( i , entry ) ;
+}
+
+/**
+ * @brief Find the heap index of a PCB.
+ * @param pcbPtr: the PCB
+ * @return unsigned: the index, or NOT_QUEUED if the PCB is not queued
+ */
+unsigned EDFReadyQueue::find( PCB* pcbPtr ) const
+{
+    unsigned i = this -> positionOf( pcbPtr -> getID() ) ;
+    if ( i >= this -> heap . size() or this -> heap[ i ] . pcb != pcbPtr )
+        return NOT_QUEUED ;
+    return i ;
+}
+
+/**
+ * @brief Take the entry at a heap index out of the heap. The last entry
+ * fills the hole and is sifted whichever way it needs to go.
+ * @param i: the index
+ */
+void EDFReadyQueue::erase( const unsigned& i )
+{
+    // The ID is forgotten in both places, in case position has grown over
+    // an ID recorded in sparse_position.
+    unsigned id = this -> heap[ i ] . pcb -> getID() ;
+    if ( id < this -> position . size() )
+        this -> position[ id ] = NOT_QUEUED ;
+    this -> sparse_position . erase( id ) ;
+    Entry last = this -> heap . back() ;
+    this -> heap . pop_back() ;
+    if ( i == this -> heap . size() )
+        return ;
+    if ( i > 0 and before( last , this -> heap[ ( i - 1 ) / ARITY ] ) )
+        this -> siftUp( i , last ) ;
+    else
+        this -> siftDown( i , last ) ;
+}
+
+/**
+ * @brief Add a PCB with a deadline into the queue.
+ * @param pcbPtr: the pointer to the PCB to be added
+ * @param deadline: the absolute deadline of the PCB
+ * @return bool: true if the PCB was added, false if it, or another PCB
+ * with its ID, is already queued, in which case nothing was done
+ */
+bool EDFReadyQueue::addPCB( PCB* pcbPtr , const uint64_t& deadline )
+{
+    unsigned id = pcbPtr -> getID() ;
+    // A second entry for the ID would leave one of them unreachable.
+    if ( this -> positionOf( id ) != NOT_QUEUED )
+        return false ;
+    pcbPtr -> setState( ProcState::READY ) ;
+    // The bound is checked before id + 1 is taken, so no ID can wrap it.
+    if ( id >= this -> position . size() and id < 2 * this -> heap . size() + DENSE_SLACK )
+        this -> position . resize( id + 1 , NOT_QUEUED ) ;
+    Entry entry ;
+    entry . deadline = deadline ;
+    entry . seq = this -> next_seq ++ ;
+    entry . pcb = pcbPtr ;
+    // Open a hole at the end and sift the new entry up into it.
+    this -> heap . push_back( entry ) ;
+    this -> siftUp( this -> heap . size() - 1 , entry ) ;
+    return true ;
+}
+
+/**
+ * @brief Remove and return the PCB with the earliest deadline.
+ * @return PCB*: the pointer to the PCB, or nullptr if the queue is empty
+ */
+PCB* EDFReadyQueue::removePCB()
+{
+    if ( this -> heap . empty() )
+        return nullptr ;
+    PCB* result = this -> heap[ 0 ] . pcb ;
+    this -> erase( 0 ) ;
+    result -> setState( ProcState::RUNNING ) ;
+    return result ;
+}
+
+/**
+ * @brief Remove a PCB from anywhere in the queue. Its state is left for
+ * the caller to set.
+ * @param pcbPtr: the pointer to the PCB to be removed
+ * @return bool: true if the PCB was removed, false if it was not queued
+ */
+bool EDFReadyQueue::remove( PCB* pcbPtr )
+{
+    unsigned i = this -> find( pcbPtr ) ;
+    if ( i == NOT_QUEUED )
+        return false ;
+    this -> erase( i ) ;
+    return true ;
+}
+
+/**
+ * @brief Change the deadline of a queued PCB. Among equal deadlines it
+ * goes behind the PCBs already queued, as if it had just been added.
+ * @param pcbPtr: the pointer to the PCB
+ * @param deadline: the new deadline
+ * @return bool: true if the PCB was queued, false if nothing was done
+ */
+bool EDFReadyQueue::changeDeadline( PCB* pcbPtr , const uint64_t& deadline )
+{
+    unsigned i = this -> find( pcbPtr ) ;
+    if ( i == NOT_QUEUED )
+        return false ;
+    Entry entry = this -> heap[ i ] ;
+    entry . deadline = deadline ;
+    entry . seq = this -> next_seq ++ ;
+    // The new sequence number is the largest, so an unchanged deadline can
+    // only move down.
+    if ( i > 0 and before( entry , this -> heap[ ( i - 1 ) / ARITY ] ) )
+        this -> siftUp( i , entry ) ;
+    else
+        this -> siftDown( i , entry ) ;
+    return true ;
+}
+
+/**
+ * @brief Get the earliest deadline in the queue.
+ * @return uint64_t: the deadline of the PCB removePCB would return, or
+ * UINT64_MAX if the queue is empty
+ */
+uint64_t EDFReadyQueue::topDeadline() const
+{
+    return this -> heap . empty() ? UINT64_MAX : this -> heap[ 0 ] . deadline ;
+}
+
+/**
+ * @brief Make room for n PCBs, so adds up to that many do not
+ * reallocate.
+ * @param n: the number of PCBs
+ */
+void EDFReadyQueue::reserve( const unsigned& n )
+{
+    this -> heap . reserve( n ) ;
+}
+
+/**
+ * @brief Returns the number of elements in the queue.
+ * @return int: the number of PCBs in the queue
+ */
+int EDFReadyQueue::size() const
+{
+    return this -> heap . size() ;
+}
+
+/**
+ * @brief Display the PCBs in the queue with their deadlines, in heap
+ * order.
+ */
+void EDFReadyQueue::displayAll() const
+{
+    puts( "Display Processes in EDFReadyQueue:" ) ;
+    for ( const Entry& entry : this -> heap )
+    {
+        entry . pcb -> display() ;
+        printf( ", Deadline: %lu\n" , ( unsigned long ) entry . deadline ) ;
+    }
+}
@@ -0,0 +1,203 @@
+/**
+ * Assignment 1: priority queue of processes
+ * @file edf_readyqueue.h
+ * @author Corey Talbert
+ * @brief EDFReadyQueue is a ready queue ordered by absolute 64-bit deadline
+ * instead of by priority: removePCB returns the PCB whose deadline is
+ * earliest. It is a 4-ary heap held in one array, so a sift touches half
+ * as many levels as a binary heap would, and the four children of a
+ * node sit next to each other in memory.
+ * @version 0.1
+ * @date 09-19-2022
+ */
+
+#pragma once
+#include <climits>
+#include <cstdint>
+#include <vector>
+#include "idmap.h"
+#include "pcb.h"
+
+/**
+ * @brief A queue of PCB's in the READY state, earliest deadline first. PCBs
+ * with equal deadlines come out in the order they were added. Adding,
+ * removing and changing a deadline are O(log n). Queued PCBs are found by
+ * ID, so the IDs of queued PCBs must be unique.
+ */
+class EDFReadyQueue
+{
+private:
+    /**
+     * @brief One slot of the heap.
+     */
+    struct Entry
+    {
+        // The absolute deadline of the PCB.
+        uint64_t deadline ;
+        // The number of adds before this one, to break ties first in,
+        // first out.
+        uint64_t seq ;
+        PCB* pcb ;
+    } ;
+
+    /**
+     * @brief The number of children of each heap node.
+     */
+    static const unsigned ARITY = 4 ;
+
+    /**
+     * @brief The position of a PCB that is not in the heap.
+     */
+    static const unsigned NOT_QUEUED = UINT_MAX ;
+
+    /**
+     * @brief The heap. The children of heap[ i ] are heap[ ARITY * i + 1 ]
+     * to heap[ ARITY * i + ARITY ].
+     */
+    std::vector<Entry> heap ;
+
+    /**
+     * @brief The index in heap of each queued PCB, indexed by PCB ID, or
+     * NOT_QUEUED. It only grows to cover IDs below twice the heap's size
+     * plus DENSE_SLACK, so its size follows the number of PCBs queued
+     * rather than the largest ID.
+     */
+    std::vector<unsigned> position ;
+
+    /**
+     * @brief The index in heap of each queued PCB whose ID was past the end
+     * of position when it was added.
+     */
+    IDMap<unsigned> sparse_position ;
+
+    /**
+     * @brief IDs below this always get a slot in position, however short
+     * the heap.
+     */
+    static const unsigned DENSE_SLACK = 1024 ;
+
+    /**
+     * @brief The sequence number of the next add.
+     */
+    uint64_t next_seq = 0 ;
+
+    /**
+     * @brief Check if an entry must come out before another.
+     * @return bool: true if a has the earlier deadline, or the same deadline
+     * and was added first
+     */
+    static bool before( const Entry& a , const Entry& b )
+    {
+        return a . deadline < b . deadline
+            or ( a . deadline == b . deadline and a . seq < b . seq ) ;
+    }
+
+    /**
+     * @brief Store an entry at a heap index and record its position.
+     */
+    void place( const unsigned& i , const Entry& entry ) ;
+
+    /**
+     * @brief Get the recorded heap index of a PCB ID.
+     * @param id: the ID
+     * @return unsigned: the index, or NOT_QUEUED
+     */
+    unsigned positionOf( const unsigned& id ) const ;
+
+    /**
+     * @brief Move an entry up from index i until its parent comes before it.
+     * @param i: the index of the hole the entry goes in
+     * @param entry: the entry
+     */
+    void siftUp( unsigned i , const Entry& entry ) ;
+
+    /**
+     * @brief Move an entry down from index i until it comes before all of
+     * its children.
+     * @param i: the index of the hole the entry goes in
+     * @param entry: the entry
+     */
+    void siftDown( unsigned i , const Entry& entry ) ;
+
+    /**
+     * @brief Find the heap index of a PCB.
+     * @param pcbPtr: the PCB
+     * @return unsigned: the index, or NOT_QUEUED if the PCB is not queued
+     */
+    unsigned find( PCB* pcbPtr ) const ;
+
+    /**
+     * @brief Take the entry at a heap index out of the heap.
+     * @param i: the index
+     */
+    void erase( const unsigned& i ) ;
+
+public:
+    /**
+     * @brief Construct an empty queue.
+     */
+    EDFReadyQueue() ;
+
+    /**
+     * @brief Destructor. The PCBs are not owned and are left alone.
+     */
+    ~EDFReadyQueue() ;
+
+    /**
+     * @brief Add a PCB with a deadline into the queue.
+     * @param pcbPtr: the pointer to the PCB to be added
+     * @param deadline: the absolute deadline of the PCB
+     * @return bool: true if the PCB was added, false if it, or another PCB
+     * with its ID, is already queued, in which case nothing was done
+     */
+    bool addPCB( PCB* pcbPtr , const uint64_t& deadline ) ;
+
+    /**
+     * @brief Remove and return the PCB with the earliest deadline.
+     * @return PCB*: the pointer to the PCB, or nullptr if the queue is empty
+     */
+    PCB* removePCB() ;
+
+    /**
+     * @brief Remove a PCB from anywhere in the queue. Its state is left for
+     * the caller to set.
+     * @param pcbPtr: the pointer to the PCB to be removed
+     * @return bool: true if the PCB was removed, false if it was not queued
+     */
+    bool remove( PCB* pcbPtr ) ;
+
+    /**
+     * @brief Change the deadline of a queued PCB. Among equal deadlines it
+     * goes behind the PCBs already queued, as if it had just been added.
+     * @param pcbPtr: the pointer to the PCB
+     * @param deadline: the new deadline
+     * @return bool: true if the PCB was queued, false if nothing was done
+     */
+    bool changeDeadline( PCB* pcbPtr , const uint64_t& deadline ) ;
+
+    /**
+     * @brief Get the earliest deadline in the queue.
+     * @return uint64_t: the deadline of the PCB removePCB would return, or
+     * UINT64_MAX if the queue is empty
+     */
+    uint64_t topDeadline() const ;
+
+    /**
+     * @brief Make room for n PCBs, so adds up to that many do not
+     * reallocate.
+     * @param n: the number of PCBs
+     */
+    void reserve( const unsigned& n ) ;
+
+    /**
+     * @brief Returns the number of elements in the queue.
+     * @return int: the number of PCBs in the queue
+     */
+    int size() const ;
+
+    /**
+     * @brief Display the PCBs in the queue with their deadlines, in heap
+     * order.
+     */
+    void displayAll() const ;
+} ; // End of class EDFReadyQueue
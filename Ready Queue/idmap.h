@@ -0,0 +1,186 @@
+/**
+ * Assignment 1: priority queue of processes
+ * @file idmap.h
+ * @author Corey Talbert
+ * @brief IDMap maps PCB IDs to a small value, such as a queue's back-pointer
+ * to the node or heap slot of each queued PCB. It is an open-addressing hash
+ * table sized to the number of entries, so any 32-bit ID can be stored and
+ * memory follows how many PCBs are queued, not how large their IDs are.
+ * @version 0.1
+ * @date 09-19-2022
+ */
+
+#pragma once
+#include <cstdint>
+#include <vector>
+
+/**
+ * @brief A hash table from PCB ID to a value of type V, with linear probing
+ * and Fibonacci hashing. It is at most half full, so a lookup usually reads one slot. Erasing
+ * shifts the following entries back instead of leaving tombstones, so
+ * lookups never slow down as PCBs come and go.
+ * @tparam V The value type, small and cheap to copy. One value, given to
+ * the constructor, marks an empty slot and cannot be stored.
+ */
+template <class V>
+class IDMap
+{
+private:
+    /**
+     * @brief One slot of the table.
+     */
+    struct Slot
+    {
+        uint32_t id ;
+        // none while the slot is empty.
+        V value ;
+    } ;
+
+    /**
+     * @brief The slots. The size is a power of two, or 0 before the first
+     * insert.
+     */
+    std::vector<Slot> slots ;
+
+    /**
+     * @brief The number of used slots.
+     */
+    unsigned count = 0 ;
+
+    /**
+     * @brief 32 less the log of the number of slots: the shift that takes
+     * the top bits of the hash.
+     */
+    unsigned shift = 32 ;
+
+    /**
+     * @brief The value get returns for an ID that is not in the map.
+     */
+    V none ;
+
+    /**
+     * @brief Get the slot an ID hashes to.
+     * @param id: the ID
+     * @return unsigned: the index of the slot
+     */
+    unsigned home( const uint32_t& id ) const
+    {
+        // Multiplying by 2^32 / phi spreads runs of consecutive IDs evenly.
+        // Taking the low bits instead would pack a run into one block of
+        // slots, and linear probing past such a block is slow.
+        return uint32_t( id * 2654435769u ) >> this -> shift ;
+    }
+
+    /**
+     * @brief Get the slot holding an ID, or the empty slot where it would go.
+     * @param id: the ID
+     * @return unsigned: the index of the slot
+     */
+    unsigned probe( const uint32_t& id ) const
+    {
+        unsigned mask = this -> slots . size() - 1 ;
+        unsigned i = this -> home( id ) ;
+        while ( this -> slots[ i ] . value != this -> none and this -> slots[ i ] . id != id )
+            i = ( i + 1 ) & mask ;
+        return i ;
+    }
+
+    /**
+     * @brief Double the number of slots, or make the first 16, and insert
+     * every entry again.
+     */
+    void grow()
+    {
+        std::vector<Slot> old ;
+        old . swap( this -> slots ) ;
+        unsigned size = old . empty() ? 16 : old . size() * 2 ;
+        this -> slots . assign( size , Slot{ 0 , this -> none } ) ;
+        this -> shift = 32 - __builtin_ctz( size ) ;
+        for ( const Slot& slot : old )
+            if ( slot . value != this -> none )
+                this -> slots[ this -> probe( slot . id ) ] = slot ;
+    }
+
+public:
+    /**
+     * @brief Construct an empty map. Nothing is allocated until the first
+     * insert.
+     * @param none: the value get returns for an ID that is not in the map
+     */
+    IDMap( const V& none = V() ) : none( none ) {}
+
+    /**
+     * @brief Get the value of an ID.
+     * @param id: the ID
+     * @return V: the value, or none if the ID is not in the map
+     */
+    V get( const uint32_t& id ) const
+    {
+        if ( this -> count == 0 )
+            return this -> none ;
+        return this -> slots[ this -> probe( id ) ] . value ;
+    }
+
+    /**
+     * @brief Set the value of an ID, adding the ID if it is not in the map.
+     * @param id: the ID
+     * @param value: the value, not none
+     */
+    void set( const uint32_t& id , const V& value )
+    {
+        if ( 2 * ( this -> count + 1 ) > this -> slots . size() )
+            this -> grow() ;
+        Slot& slot = this -> slots[ this -> probe( id ) ] ;
+        if ( slot . value == this -> none )
+        {
+            slot . id = id ;
+            ++ this -> count ;
+        }
+        slot . value = value ;
+    }
+
+    /**
+     * @brief Remove an ID from the map, if it is there.
+     * @param id: the ID
+     */
+    void erase( const uint32_t& id )
+    {
+        if ( this -> count == 0 )
+            return ;
+        unsigned mask = this -> slots . size() - 1 ;
+        unsigned hole = this -> probe( id ) ;
+        if ( this -> slots[ hole ] . value == this -> none )
+            return ;
+        // Each entry after the hole moves back into it unless its home lies
+        // cyclically after the hole and at or before the entry, where the
+        // entry would then no longer be reachable from its home.
+        for ( unsigned i = ( hole + 1 ) & mask ; this -> slots[ i ] . value != this -> none ; i = ( i + 1 ) & mask )
+        {
+            unsigned h = this -> home( this -> slots[ i ] . id ) ;
+            if ( ( ( i - h ) & mask ) >= ( ( i - hole ) & mask ) )
+            {
+                this -> slots[ hole ] = this -> slots[ i ] ;
+                hole = i ;
+            }
+        }
+        this -> slots[ hole ] . value = this -> none ;
+        -- this -> count ;
+    }
+
+    /**
+     * @brief Make room for n entries, so adding up to that many does not
+     * rehash.
+     * @param n: the number of entries
+     */
+    void reserve( const unsigned& n )
+    {
+        while ( 2 * n > this -> slots . size() )
+            this -> grow() ;
+    }
+
+    /**
+     * @brief Get the number of IDs in the map.
+     * @return unsigned: the number of entries
+     */
+    unsigned size() const { return this -> count ; }
+} ;
@@ -0,0 +1,138 @@
+/**
+ * Assignment 1: priority queue of processes
+ * @file manifest.cpp
+ * @author Corey Talbert
+ * @brief Mapping and writing process manifest files.
+ * @date 09-19-2022
+ */
+
+#include <cstdio>
+#include <cstring>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#include "manifest.h"
+
+/**
+ * @brief The magic number at the start of a manifest file.
+ */
+static const char MANIFEST_MAGIC[ 4 ] = { 'P' , 'C' , 'M' , '1' } ;
+
+/**
+ * @brief The size of the header before the records.
+ */
+static const size_t MANIFEST_HEADER = sizeof( MANIFEST_MAGIC ) + sizeof( uint32_t ) ;
+
+ManifestFile::ManifestFile() {}
+
+/**
+ * @brief Destructor. Unmaps the file.
+ */
+ManifestFile::~ManifestFile()
+{
+    this -> close() ;
+}
+
+/**
+ * @brief Map a manifest, replacing any mapped before.
+ * @param path: the file name
+ * @return bool: true if the file was mapped and its size matches its
+ * record count
+ */
+bool ManifestFile::open( const char* path )
+{
+    this -> close() ;
+    int fd = ::open( path , O_RDONLY ) ;
+    if ( fd < 0 )
+        return false ;
+    struct stat info ;
+    if ( fstat( fd , &info ) != 0 or size_t( info . st_size ) < MANIFEST_HEADER )
+    {
+        ::close( fd ) ;
+        return false ;
+    }
+    this -> length = info . st_size ;
+    void* map = mmap( nullptr , this -> length , PROT_READ , MAP_PRIVATE , fd , 0 ) ;
+    // The mapping outlives the descriptor.
+    ::close( fd ) ;
+    if ( map == MAP_FAILED )
+        return false ;
+    this -> map = map ;
+    // The file is read once, front to back.
+    madvise( this -> map , this -> length , MADV_SEQUENTIAL ) ;
+
+    const char* bytes = static_cast<const char*>( this -> map ) ;
+    uint32_t count ;
+    memcpy( &count , bytes + sizeof( MANIFEST_MAGIC ) , sizeof( count ) ) ;
+    if ( memcmp( bytes , MANIFEST_MAGIC , sizeof( MANIFEST_MAGIC ) ) != 0
+        or this -> length != MANIFEST_HEADER + size_t( count ) * sizeof( ManifestRecord ) )
+    {
+        this -> close() ;
+        return false ;
+    }
+    // The header is 8 bytes and the mapping page aligned, so the records are
+    // aligned for direct access.
+    this -> records = reinterpret_cast<const ManifestRecord*>( bytes + MANIFEST_HEADER ) ;
+    this -> count = count ;
+    return true ;
+}
+
+/**
+ * @brief Unmap the file.
+ */
+void ManifestFile::close()
+{
+    if ( this -> map )
+        munmap( this -> map , this -> length ) ;
+    this -> map = nullptr ;
+    this -> length = 0 ;
+    this -> records = nullptr ;
+    this -> count = 0 ;
+}
+
+/**
+ * @brief Get the records.
+ * @return const ManifestRecord*: the first record
+ */
+const ManifestRecord* ManifestFile::begin() const
+{
+    return this -> records ;
+}
+
+/**
+ * @brief Get the end of the records.
+ * @return const ManifestRecord*: one past the last record
+ */
+const ManifestRecord* ManifestFile::end() const
+{
+    return this -> records + this -> count ;
+}
+
+/**
+ * @brief Get the number of records.
+ * @return uint32_t: the record count
+ */
+uint32_t ManifestFile::size() const
+{
+    return this -> count ;
+}
+
+/**
+ * @brief Write a manifest file.
+ * @param path: the file name
+ * @param records: the processes
+ * @return bool: true if the whole manifest was written
+ */
+bool writeManifest( const char* path , const std::vector<ManifestRecord>& records )
+{
+    FILE* file = fopen( path , "wb" ) ;
+    if ( file == NULL )
+        return false ;
+    uint32_t count = records . size() ;
+    bool ok = fwrite( MANIFEST_MAGIC , sizeof( MANIFEST_MAGIC ) , 1 , file ) == 1
+        and fwrite( &count , sizeof( count ) , 1 , file ) == 1
+        and ( count == 0
+              or fwrite( records . data() , sizeof( ManifestRecord ) , count , file ) == count ) ;
+    return fclose( file ) == 0 and ok ;
+}
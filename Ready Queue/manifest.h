@@ -0,0 +1,178 @@
+/**
+ * Assignment 1: priority queue of processes
+ * @file manifest.h
+ * @author Corey Talbert
+ * @brief Loading a PCBTable and its ReadyQueue from a process manifest: a
+ * binary file of fixed-size (pid, priority, state) records. The file is
+ * memory-mapped and checked in full before anything is loaded, and each
+ * record is then built straight into its slot of the table, so a SLAB table
+ * is filled without allocating a PCB per record.
+ * @version 0.1
+ * @date 09-19-2022
+ */
+
+#pragma once
+#include <algorithm>
+#include <cstdint>
+#include <vector>
+#include "idmap.h"
+#include "pcbtable.h"
+#include "readyqueue.h"
+
+/**
+ * @brief One process of a manifest.
+ */
+struct ManifestRecord
+{
+    // The process ID, which is also its index in the table.
+    uint32_t pid ;
+    uint16_t priority ;
+    // The ProcState of the process. READY processes are put in the queue.
+    uint8_t state ;
+    // Zero.
+    uint8_t reserved ;
+} ;
+
+static_assert( sizeof( ManifestRecord ) == 8 , "ManifestRecord must stay at 8 bytes" ) ;
+
+/**
+ * @brief A manifest file mapped read-only into memory. On disk it is a
+ * 4-byte magic number, a 4-byte record count and the records, all in host
+ * byte order.
+ */
+class ManifestFile
+{
+private:
+    /**
+     * @brief The mapping of the whole file, or nullptr.
+     */
+    void* map = nullptr ;
+
+    /**
+     * @brief The length of the mapping in bytes.
+     */
+    size_t length = 0 ;
+
+    /**
+     * @brief The records, inside the mapping.
+     */
+    const ManifestRecord* records = nullptr ;
+
+    /**
+     * @brief The number of records.
+     */
+    uint32_t count = 0 ;
+
+public:
+    ManifestFile() ;
+
+    /**
+     * @brief Destructor. Unmaps the file.
+     */
+    ~ManifestFile() ;
+
+    ManifestFile( const ManifestFile& ) = delete ;
+    ManifestFile& operator=( const ManifestFile& ) = delete ;
+
+    /**
+     * @brief Map a manifest, replacing any mapped before.
+     * @param path: the file name
+     * @return bool: true if the file was mapped and its size matches its
+     * record count
+     */
+    bool open( const char* path ) ;
+
+    /**
+     * @brief Unmap the file.
+     */
+    void close() ;
+
+    /**
+     * @brief Get the records.
+     * @return const ManifestRecord*: the first record
+     */
+    const ManifestRecord* begin() const ;
+
+    /**
+     * @brief Get the end of the records.
+     * @return const ManifestRecord*: one past the last record
+     */
+    const ManifestRecord* end() const ;
+
+    /**
+     * @brief Get the number of records.
+     * @return uint32_t: the record count
+     */
+    uint32_t size() const ;
+} ;
+
+/**
+ * @brief Write a manifest file.
+ * @param path: the file name
+ * @param records: the processes
+ * @return bool: true if the whole manifest was written
+ */
+bool writeManifest( const char* path , const std::vector<ManifestRecord>& records ) ;
+
+/**
+ * @brief Fill a table and a ready queue from a manifest. Each process is
+ * built at index pid of the table with its priority and state, and READY
+ * processes are added to the queue, in file order, in batches. With a SLAB
+ * table nothing is allocated per record. Every record is checked before any
+ * is loaded, so an invalid manifest leaves the table and the queue as they
+ * were. A record is invalid if its pid is not below PCBTable::MAX_CAPACITY,
+ * is already in the table or appears twice in the file, if its state is not a
+ * ProcState, or if it is READY with a priority the queue cannot hold.
+ * @param path: the manifest file name
+ * @param table: the table to fill, best made with PCBStorage::SLAB
+ * @param queue: the queue to add the READY processes to
+ * @return long: the number of records loaded, or -1 if the file could not be
+ * mapped or a record was invalid, in which case nothing was loaded
+ */
+template <unsigned LEVELS>
+long loadManifest( const char* path , PCBTable& table , ReadyQueue<LEVELS>& queue )
+{
+    ManifestFile file ;
+    if ( not file . open( path ) )
+        return -1 ;
+
+    // Check every record first. The pids seen are kept in an IDMap, so the
+    // check takes memory for the records, not for the largest pid.
+    IDMap<bool> seen( false ) ;
+    seen . reserve( file . size() ) ;
+    uint32_t top = 0 ;
+    for ( const ManifestRecord& record : file )
+    {
+        if ( record . pid >= PCBTable::MAX_CAPACITY
+            or ( record . pid < table . capacity() and table . getPCB( record . pid ) )
+            or seen . get( record . pid )
+            or record . state > uint8_t( ProcState::TERMINATED )
+            or ( record . state == uint8_t( ProcState::READY ) and record . priority >= LEVELS ) )
+            return -1 ;
+        seen . set( record . pid , true ) ;
+        top = std::max( top , record . pid + 1 ) ;
+    }
+    // The table grows once, to just past the largest pid.
+    table . reserve( top ) ;
+
+    // READY processes wait here and go into the queue a batch at a time.
+    const unsigned BATCH = 256 ;
+    PCB* ready[ BATCH ] ;
+    unsigned pending = 0 ;
+    for ( const ManifestRecord& record : file )
+    {
+        PCB* pcbPtr = table . resolve( table . addNewPCB( record . pid , record . priority , record . pid ) ) ;
+        pcbPtr -> setState( ProcState( record . state ) ) ;
+        if ( record . state == uint8_t( ProcState::READY ) )
+        {
+            ready[ pending++ ] = pcbPtr ;
+            if ( pending == BATCH )
+            {
+                queue . addPCBs( ready , ready + pending ) ;
+                pending = 0 ;
+            }
+        }
+    }
+    queue . addPCBs( ready , ready + pending ) ;
+    return file . size() ;
+}
@@ -0,0 +1,140 @@
+/**
+ * Assignment 1: priority queue of processes
+ * @file nodepool.h
+ * @author Corey Talbert
+ * @brief NodePool is a slab allocator for fixed-size linked list nodes. Nodes
+ * are carved out of preallocated chunks and recycled through a free list, so a
+ * list that appends and pops all day stops calling new and delete.
+ * @version 0.1
+ * @date 09-19-2022
+ */
+
+#pragma once
+#include <new>
+#include <utility>
+#include <vector>
+
+/**
+ * @brief Usage statistics of a NodePool.
+ */
+struct NodePoolStats
+{
+    // The number of nodes the pool can hand out without growing.
+    unsigned capacity = 0 ;
+    // The number of nodes currently handed out.
+    unsigned in_use = 0 ;
+    // The largest number of nodes ever handed out at once.
+    unsigned high_water = 0 ;
+    // The number of chunks allocated.
+    unsigned chunks = 0 ;
+} ;
+
+/**
+ * @brief A pool of list nodes of type T. The pool grows CHUNK nodes at a time
+ * and never shrinks; released nodes go on a free list and are handed out
+ * again before the pool grows. The chunks are freed when the pool is
+ * destroyed, so nodes must not outlive their pool.
+ */
+template <class T, unsigned CHUNK = 256>
+class NodePool
+{
+private:
+    /**
+     * @brief A free slot holds the free list link, a used slot holds a T.
+     */
+    union Slot
+    {
+        Slot* next_free ;
+        alignas( T ) unsigned char storage[ sizeof( T ) ] ;
+    } ;
+
+    /**
+     * @brief The first free slot.
+     */
+    Slot* free_list = nullptr ;
+
+    /**
+     * @brief Every chunk of CHUNK slots allocated by the pool.
+     */
+    std::vector<Slot*> chunks ;
+
+    /**
+     * @brief The usage statistics.
+     */
+    NodePoolStats stats ;
+
+    /**
+     * @brief Allocate a new chunk and thread its slots onto the free list.
+     */
+    void grow()
+    {
+        Slot* chunk = new Slot[ CHUNK ] ;
+        this -> chunks . push_back( chunk ) ;
+        // Slots are linked in address order so consecutive acquires walk the
+        // chunk sequentially.
+        for ( unsigned i = CHUNK ; i > 0 ; --i )
+        {
+            chunk[ i - 1 ] . next_free = this -> free_list ;
+            this -> free_list = &chunk[ i - 1 ] ;
+        }
+        this -> stats . capacity += CHUNK ;
+        ++ this -> stats . chunks ;
+    }
+
+public:
+    /**
+     * @brief Construct an empty pool. No chunk is allocated until needed.
+     */
+    NodePool() {}
+
+    /**
+     * @brief Destroy the pool and free all of its chunks.
+     */
+    ~NodePool()
+    {
+        for ( Slot* chunk : this -> chunks )
+            delete[] chunk ;
+    }
+
+    NodePool( const NodePool& ) = delete ;
+    NodePool& operator=( const NodePool& ) = delete ;
+
+    /**
+     * @brief Take a node from the pool, growing it if no node is free.
+     * @param args The arguments for the node constructor.
+     * @return T*: the new node
+     */
+    template <class... Args>
+    T* acquire( Args&&... args )
+    {
+        if ( this -> free_list == nullptr )
+            this -> grow() ;
+        Slot* slot = this -> free_list ;
+        this -> free_list = slot -> next_free ;
+        if ( ++ this -> stats . in_use > this -> stats . high_water )
+            this -> stats . high_water = this -> stats . in_use ;
+        return new ( slot -> storage ) T( std::forward<Args>( args )... ) ;
+    }
+
+    /**
+     * @brief Return a node to the pool.
+     * @param node A node previously acquired from this pool.
+     */
+    void release( T* node )
+    {
+        node -> ~T() ;
+        Slot* slot = reinterpret_cast<Slot*>( node ) ;
+        slot -> next_free = this -> free_list ;
+        this -> free_list = slot ;
+        -- this -> stats . in_use ;
+    }
+
+    /**
+     * @brief Get the usage statistics of the pool.
+     * @return NodePoolStats: capacity, nodes in use, high-water mark and chunks
+     */
+    NodePoolStats getStats() const
+    {
+        return this -> stats ;
+    }
+} ;
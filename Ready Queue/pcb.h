@@ -21,6 +21,20 @@ const unsigned MAX_PRIORITY = 50 ;
  */
 const unsigned MIN_PRIORITY = 1 ;
 
+/**
+ * @brief Uncomment (or build with -DREADYQUEUE_INTRUSIVE) to give each PCB its
+ * own ready queue link. The ReadyQueue then chains PCBs directly and adding or
+ * removing a PCB does no heap allocation.
+ */
+//#define READYQUEUE_INTRUSIVE
+
+/**
+ * @brief Uncomment (or build with -DREADYQUEUE_STATS) to have ReadyQueue
+ * record how long PCBs wait and how deep its lists get. See
+ * readyqueue_stats.h.
+ */
+//#define READYQUEUE_STATS
+
 
 // enum class of process state
 // A process (PCB) in ready queue should be in READY state
@@ -41,6 +55,19 @@ public:
 	// The current state of the process.
 	// A process in the ReadyQueue should be in READY state
 	ProcState state;
+#ifdef READYQUEUE_INTRUSIVE
+    // The next and previous PCBs in the same ReadyQueue list. Owned by the
+    // ReadyQueue while the PCB is queued; a PCB can only be in one ReadyQueue
+    // at a time.
+    PCB* next = nullptr;
+    PCB* prev = nullptr;
+    // The ReadyQueue's dispatch count when the PCB was queued, for aging.
+    unsigned long enqueued_at = 0;
+#ifdef READYQUEUE_STATS
+    // The clock in ns when the PCB was queued, for the wait statistics.
+    unsigned long enqueued_ns = 0;
+#endif
+#endif
 
 	/**
 	 * @brief Construct a new PCB object
@@ -0,0 +1,191 @@
+/**
+ * Assignment 1: priority queue of processes
+ * @file pcblist.cpp
+ * @author Corey Talbert
+ * @brief Implementation of pcblist.h as a doubly-linked FIFO list.
+ * @date 09-19-2022
+ */
+#include "pcblist.h"
+
+/**
+* @brief Construct an empty list. 
+*/
+PCBList::PCBList() {}
+
+/** 
+ * @brief Destroy a list. The nodes belong to the pool and are not
+ * freed here.
+ */
+PCBList::~PCBList() {}
+
+/** 
+ * @brief Check if the list is empty.
+ * @return bool: True if the list is empty, otherwise false.
+ */
+bool PCBList::isEmpty() const { return not this -> size ; }
+
+/** 
+ * @brief Get the rq_size member.
+ * @return unsigned: the number of PCB pointers in the list.
+ */
+unsigned PCBList::getSize() const { return this -> size ; }
+
+/**
+ * @brief Call the display method on each PCB pointed to in the list.
+ * @return void
+ */
+void PCBList::display() const 
+{
+    //printf( "\nList @ 0x%p, size = %u:\t\n", this, size ) ;
+    //unsigned i = 0 ; // Index counter for test output.
+    // Call PCB::display() on each element in the list.
+    for ( Node* itr = this -> head ; itr ; itr = itr -> next )
+    {
+        //printf("\t[%u]\t0x%p:\t", ++i, itr -> data ) ;
+        putchar('\t') ;
+        payload( itr ) -> display() ;
+        putchar('\n') ;
+        //puts( itr -> next ? " -> " : ""  ) ;
+    }
+}
+
+/**
+ * @brief Reset the list to an empty state.
+ * @param pool The pool the nodes are returned to.
+ */
+void PCBList::clear( Pool& pool )
+{
+    if ( not this -> isEmpty() )
+    {
+#ifdef READYQUEUE_INTRUSIVE
+        // The PCBs are the nodes and are not owned, so only their links are
+        // reset, leaving them free to join another list. The pool is unused.
+        ( void ) pool ;
+        for (   Node* itr = this -> head, *temp = nullptr ; 
+                itr ;
+                temp = itr, itr = itr -> next, temp -> next = temp -> prev = nullptr ) ;
+#else
+        // Return each node in the list to the pool.
+        for (   Node* itr = this -> head, *temp = nullptr ; 
+                itr ;
+                temp = itr, itr = itr -> next, pool . release( temp ) ) ;
+#endif
+        // Reset member variables to represent an empty state.
+        this -> head = this -> tail = nullptr ;
+        this -> size = 0 ;
+    }
+}
+
+/**
+ * @brief Remove the front (head) node from the list.
+ * @param pool The pool the node is returned to.
+ * @return PCB*: The payload member in the head node.
+ */
+PCB* PCBList::popFront( Pool& pool ) 
+{
+    PCB* pop_data = nullptr ; 
+    // Remove list head and update list state.
+    if ( not this -> isEmpty() )
+    {
+        pop_data = this -> unlink( this -> head , pool ) ;
+    } 
+    return pop_data ;
+}
+
+/**
+ * @brief Remove a run of up to count nodes from the front of the list,
+ * relinking the list once for the whole run.
+ * @param count The largest number of nodes to remove.
+ * @param out Where the payloads of the removed nodes are written, in order.
+ * @param pool The pool the nodes are returned to.
+ * @return unsigned: The number of nodes removed.
+ */
+unsigned PCBList::popFront( const unsigned& count , PCB** out , Pool& pool )
+{
+    unsigned n = 0 ;
+    Node* itr = this -> head ;
+    while ( itr and n < count )
+    {
+        Node* next = itr -> next ;
+        out[ n++ ] = payload( itr ) ;
+#ifdef READYQUEUE_INTRUSIVE
+        ( void ) pool ;
+        itr -> next = itr -> prev = nullptr ;
+#else
+        pool . release( itr ) ;
+#endif
+        itr = next ;
+    }
+    // The rest of the list, if any, starts at the first node not taken.
+    this -> head = itr ;
+    if ( itr )
+        itr -> prev = nullptr ;
+    else
+        this -> tail = nullptr ;
+    this -> size -= n ;
+    return n ;
+}
+
+/**
+ * @brief Add a node to the end of the list.
+ * @param new_data The PCB pointer to be held by the node.
+ * @param pool The pool the node is taken from.
+ */
+PCBList::Node* PCBList::append( PCB* new_data , Pool& pool )
+{
+#ifdef READYQUEUE_INTRUSIVE
+    ( void ) pool ;
+    Node* new_node = new_data ;
+#else
+    Node* new_node = pool . acquire() ;
+    new_node -> data = new_data ;
+#endif
+    new_node -> next = nullptr ;
+    new_node -> prev = this -> tail ;
+    if ( this -> isEmpty() )
+        this -> head = this -> tail = new_node ;
+    else
+    {
+        this -> tail -> next = new_node ;
+        this -> tail = this -> tail -> next ;
+    }
+    ++ this -> size ;
+    return new_node ;
+}
+
+/**
+ * @brief Remove a node from anywhere in the list in O(1).
+ * @param node A node of this list.
+ * @param pool The pool the node is returned to.
+ * @return PCB*: The payload member of the node.
+ */
+PCB* PCBList::unlink( Node* node , Pool& pool )
+{
+    PCB* data = payload( node ) ;
+    // Bridge the neighbours over the node, or move head or tail past it.
+    if ( node -> prev )
+        node -> prev -> next = node -> next ;
+    else
+        this -> head = node -> next ;
+    if ( node -> next )
+        node -> next -> prev = node -> prev ;
+    else
+        this -> tail = node -> prev ;
+#ifdef READYQUEUE_INTRUSIVE
+    ( void ) pool ;
+    node -> next = node -> prev = nullptr ;
+#else
+    pool . release( node ) ;
+#endif
+    -- this -> size ;
+    return data ;
+}
+
+/**
+ * @brief Get the front (head) node of the list.
+ * @return Node*: The head node, or nullptr if the list is empty.
+ */
+PCBList::Node* PCBList::front() const
+{
+    return this -> head ;
+}
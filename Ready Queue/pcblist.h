@@ -0,0 +1,157 @@
+/**
+ * Assignment 1: priority queue of processes
+ * @file pcblist.h
+ * @author Corey Talbert
+ * @brief PCBList is the FIFO list of PCB pointers that holds the processes of
+ * one priority level in a ReadyQueue.
+ * @version 0.1
+ * @date 09-19-2022
+ */
+
+#pragma once
+#include "pcb.h"
+#include "nodepool.h"
+
+/** 
+ * @brief A queue-like, FIFO, doubly-linked list of PCB pointers
+ * representing an ordered list of processes at the same priority level.
+ * ReadyQueue and ConcurrentReadyQueue are implemented as arrays of these lists.
+ */
+class PCBList
+{
+public:
+
+#ifdef READYQUEUE_INTRUSIVE
+    /**
+     * @brief In intrusive mode the PCBs are the nodes, linked through
+     * PCB::next and PCB::prev.
+     */
+    typedef PCB Node ;
+
+    /**
+     * @brief Get the PCB held by a node.
+     */
+    static PCB* payload( Node* node ) { return node ; }
+#else
+    /** 
+     * @brief A simple liked list node with forward and backward links
+     * and a PCB pointer payload. 
+     */
+    struct Node
+    {
+        PCB* data = nullptr ;
+        Node* next = nullptr ;
+        Node* prev = nullptr ;
+        // The ReadyQueue's dispatch count when the PCB was queued, for aging.
+        unsigned long enqueued_at = 0 ;
+#ifdef READYQUEUE_STATS
+        // The clock in ns when the PCB was queued, for the wait statistics.
+        unsigned long enqueued_ns = 0 ;
+#endif
+    } ;
+
+    /**
+     * @brief Get the PCB held by a node.
+     */
+    static PCB* payload( Node* node ) { return node -> data ; }
+#endif
+
+    /**
+     * @brief The pool the list nodes are taken from. Unused in intrusive
+     * mode, where there are no separate nodes.
+     */
+    typedef NodePool<Node> Pool ;
+
+private:
+    
+    /** 
+     * @brief The front and oldest element of the list. 
+     */
+    Node* head = nullptr ;
+    
+    /** 
+     * @brief The end and newest element of the list. 
+     */
+    Node* tail = nullptr ;
+    
+    /** 
+     * @brief The number of elements in the list. 
+     */
+    unsigned size = 0 ;
+
+public:
+    /**
+     * @brief Construct an empty list. 
+     */
+    PCBList() ;
+    
+    /** 
+     * @brief Destroy a list. The nodes belong to the pool and are not
+     * freed here.
+     */
+    ~PCBList() ;
+    
+    /** 
+     * @brief Check if the list is empty.
+     * @return bool: True if the list is empty, otherwise false.
+     */
+    bool isEmpty() const ;    
+    
+    /** 
+     * @brief Get the rq_size member.
+     * @return unsigned: the number of PCB pointers in the list.
+     */
+    unsigned getSize() const ;
+    
+    /**
+     * @brief Call the display method on each PCB pointed to in the list.
+     * @return void
+     */
+    void display() const ;
+    
+    /**
+     * @brief Reset the list to an empty state.
+     * @param pool The pool the nodes are returned to.
+     */
+    void clear( Pool& pool ) ;
+    
+    /**
+     * @brief Remove the front (head) node from the list.
+     * @param pool The pool the node is returned to.
+     * @return PCB*: The payload member in the head node.
+     */
+    PCB* popFront( Pool& pool ) ;
+
+    /**
+     * @brief Remove a run of up to count nodes from the front of the list,
+     * relinking the list once for the whole run.
+     * @param count The largest number of nodes to remove.
+     * @param out Where the payloads of the removed nodes are written, in order.
+     * @param pool The pool the nodes are returned to.
+     * @return unsigned: The number of nodes removed.
+     */
+    unsigned popFront( const unsigned& count , PCB** out , Pool& pool ) ;
+
+    /**
+     * @brief Add a node to the end of the list.
+     * @param new_data The PCB pointer to be held by the node.
+     * @param pool The pool the node is taken from.
+     * @return Node*: The new node, which can later be passed to unlink.
+     */
+    Node* append( PCB* new_data , Pool& pool ) ;
+
+    /**
+     * @brief Remove a node from anywhere in the list in O(1).
+     * @param node A node of this list.
+     * @param pool The pool the node is returned to.
+     * @return PCB*: The payload member of the node.
+     */
+    PCB* unlink( Node* node , Pool& pool ) ;
+
+    /**
+     * @brief Get the front (head) node of the list.
+     * @return Node*: The head node, or nullptr if the list is empty.
+     */
+    Node* front() const ;
+
+} ; // End of class PCBList
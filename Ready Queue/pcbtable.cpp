@@ -1,59 +1,333 @@
-/**
- * Assignment 1: priority queue of processes
- * @file pcbtable.h
- * @author Corey Talbert
- * @brief This is the implementation file for the PCBTable class.
- * @date 09-19-2022
- */
-
-#include "pcbtable.h"
-
-/**
- * @brief Construct a new PCBTable object of the given size (number of PCBs)
- * @param size: the capacity of the PCBTable
- */
-PCBTable::PCBTable( const int& size ) 
-    : table( vector<PCB*>( size ) ) 
-{}
-
-/**
- * @brief Destroy the PCBTable object. Make sure to delete all the PCBs in the table.
- */
-PCBTable::~PCBTable()
-{   
-    // Destroy each block in the table
-    if ( not this -> table . empty() ) // Maybe don't bother
-    {    
-        for ( PCB* block : this -> table ) 
-        {    
-            if ( block ) 
-            {   
-                //printf( "Deleting PCB id=%u\N", block->getID() ) ;
-                delete block ; 
-            }
-        }           
-    }
-}
-
-/**
- * @brief Get the PCB at index "idx" of the PCBTable.
- * @param idx: the index of the PCB to get
- * @return PCB*: pointer to the PCB at index "idx"
- */
-PCB* PCBTable::getPCB( const unsigned& idx ) const 
-{
-    //printf( "pcbtable.cpp::getPCB(%u)\n", idx ) ;
-    return idx < table . size() // Verify parameter
-        ? table[ idx ] // Either get pointer, or...
-        : ( printf( "\n%u is an invalid index.", idx ), nullptr ) ; // bad index
-}
-
-/**
- * @brief Add a PCB to the PCBTable.
- * @param pcb: the PCB to add
- */
-void PCBTable::addPCB( PCB* pcb, const unsigned& idx ) 
-{
-    //printf( "pcbtable.cpp::addPCB(0x%p, %u)\n", pcb, idx ) ;
-    this -> table[ idx ] = pcb ;
-}
\ No newline at end of file
+/**
+ * Assignment 1: priority queue of processes
+ * @file pcbtable.h
+ * @author Corey Talbert
+ * @brief This is the implementation file for the PCBTable class.
+ * @date 09-19-2022
+ */
+
+#include <functional>
+#include "pcbtable.h"
+
+// Definitions of the class constants, for callers that bind them to a
+// reference.
+const unsigned PCBTable::SLAB_SIZE ;
+const unsigned PCBTable::MAX_CAPACITY ;
+
+/**
+ * @brief Construct a new PCBTable object of the given size (number of PCBs)
+ * @param size: the capacity of the PCBTable
+ * @param storage: whether PCBs are allocated one by one or kept in slabs
+ */
+PCBTable::PCBTable( const int& size , const PCBStorage& storage ) 
+    : storage( storage ) , generations( size )
+{
+    if ( storage == PCBStorage::HEAP )
+        this -> table = vector<PCB*>( size ) ;
+    else
+        this -> slabs = vector<PCB*>( ( size + SLAB_SIZE - 1 ) / SLAB_SIZE ) ;
+}
+
+/**
+ * @brief Destroy the PCBTable object. Make sure to delete all the PCBs in the table.
+ */
+PCBTable::~PCBTable()
+{   
+    // Destroy each block in the table
+    if ( not this -> table . empty() ) // Maybe don't bother
+    {    
+        for ( PCB* block : this -> table ) 
+        {    
+            if ( block ) 
+            {   
+                //printf( "Deleting PCB id=%u\N", block->getID() ) ;
+                delete block ; 
+            }
+        }           
+    }
+    // Destroy each slab
+    for ( PCB* slab : this -> slabs )
+        delete[] slab ;
+}
+
+/**
+ * @brief Get the slot of a PCB in SLAB storage, allocating its slab if
+ * needed.
+ * @param idx The index of the slot.
+ * @return PCB*: the slot
+ */
+PCB* PCBTable::slot( const unsigned& idx )
+{
+    PCB*& slab = this -> slabs[ idx / SLAB_SIZE ] ;
+    if ( slab == nullptr )
+        slab = new PCB[ SLAB_SIZE ] ;
+    return &slab[ idx % SLAB_SIZE ] ;
+}
+
+/**
+ * @brief Check whether a PCB lives in one of the slabs of SLAB storage.
+ * @param pcb The PCB.
+ * @return bool: true if pcb points into a slab
+ */
+bool PCBTable::inSlab( const PCB* pcb ) const
+{
+    // std::less gives a total order even on pointers into different arrays.
+    std::less<const PCB*> before ;
+    for ( const PCB* slab : this -> slabs )
+        if ( slab and not before( pcb , slab ) and before( pcb , slab + SLAB_SIZE ) )
+            return true ;
+    return false ;
+}
+
+/**
+ * @brief Mark a slot as holding a new PCB.
+ * @param idx The index of the slot.
+ */
+void PCBTable::occupy( const unsigned& idx )
+{
+    // A PCB already in the slot is replaced, which ends its generation first.
+    if ( this -> generations[ idx ] % 2 )
+        this -> generations[ idx ] += 2 ;
+    else
+    {
+        ++ this -> generations[ idx ] ;
+        ++ this -> live ;
+    }
+}
+
+/**
+ * @brief Mark a slot as empty.
+ * @param idx The index of the slot.
+ */
+void PCBTable::vacate( const unsigned& idx )
+{
+    // The slot's generation becomes even, so every handle to it goes stale.
+    ++ this -> generations[ idx ] ;
+    -- this -> live ;
+}
+
+/**
+ * @brief Get the PCB at index "idx" of the PCBTable.
+ * @param idx: the index of the PCB to get
+ * @return PCB*: pointer to the PCB at index "idx", or nullptr if there is none
+ */
+PCB* PCBTable::getPCB( const unsigned& idx ) const 
+{
+    //printf( "pcbtable.cpp::getPCB(%u)\n", idx ) ;
+    if ( idx >= this -> generations . size() ) // Verify parameter
+        return ( printf( "\n%u is an invalid index.", idx ), nullptr ) ; // bad index
+    if ( this -> storage == PCBStorage::HEAP )
+        return table[ idx ] ;
+    // A slab slot only holds a PCB while its generation is odd.
+    return this -> generations[ idx ] % 2
+        ? &this -> slabs[ idx / SLAB_SIZE ][ idx % SLAB_SIZE ]
+        : nullptr ;
+}
+
+/**
+ * @brief Add a PCB to the PCBTable at index idx. The table takes ownership
+ * of the PCB. In HEAP storage a different PCB already at idx is deleted. In
+ * SLAB storage the PCB is copied into the slab and the caller's pointer is
+ * deleted, unless it points into the table's own slabs, in which case it is
+ * only copied. Either way a pointer that is deleted must not still be in a
+ * ReadyQueue.
+ * @param pcb: the PCB to add
+ * @param idx: the index to add the PCB at
+ * @return bool: true if the PCB was added, false if idx is not below
+ * MAX_CAPACITY, in which case the caller keeps the PCB
+ */
+bool PCBTable::addPCB( PCB* pcb, const unsigned& idx ) 
+{
+    //printf( "pcbtable.cpp::addPCB(0x%p, %u)\n", pcb, idx ) ;
+    if ( idx >= MAX_CAPACITY ) // Verify parameter before growing to it
+        return ( printf( "\n%u is an invalid index.", idx ), false ) ;
+    this -> reserve( idx + 1 ) ;
+    if ( this -> storage == PCBStorage::HEAP )
+    {
+        if ( this -> table[ idx ] != pcb )
+            delete this -> table[ idx ] ;
+        this -> table[ idx ] = pcb ;
+    }
+    else
+    {
+        PCB* target = this -> slot( idx ) ;
+        if ( target != pcb )
+            *target = *pcb ;
+        // A PCB from a slab belongs to the slab; only one the caller
+        // allocated is deleted.
+        if ( not this -> inSlab( pcb ) )
+            delete pcb ;
+    }
+    this -> occupy( idx ) ;
+    return true ;
+}
+
+/**
+ * @brief Add a new PCB to the PCBTable. A PCB already at idx is destroyed.
+ * @param pid Id of the new PCB
+ * @param priority Priority of the new PCB
+ * @param idx The index of the new PCB in the PCBTable
+ * @return PCBHandle: a handle to the new PCB, or one that never resolves
+ * if idx is not below MAX_CAPACITY
+ */
+PCBHandle PCBTable::addNewPCB( const unsigned& pid, 
+                               const unsigned& priority, 
+                               const unsigned& idx )
+{
+    if ( idx >= MAX_CAPACITY ) // Verify parameter before growing to it
+        return ( printf( "\n%u is an invalid index.", idx ), PCBHandle() ) ;
+    this -> reserve( idx + 1 ) ;
+    if ( this -> storage == PCBStorage::HEAP )
+    {
+        delete this -> table[ idx ] ;
+        this -> table[ idx ] = new PCB( pid, priority ) ;
+    }
+    else // Built in the slab; no allocation unless the slab is new.
+        *this -> slot( idx ) = PCB( pid, priority ) ;
+    this -> occupy( idx ) ;
+    return this -> getHandle( idx ) ;
+}
+
+/**
+ * @brief Get a handle to the PCB at index idx.
+ * @param idx: the index of the PCB
+ * @return PCBHandle: a handle to the PCB, which does not resolve if there
+ * is no PCB at idx
+ */
+PCBHandle PCBTable::getHandle( const unsigned& idx ) const
+{
+    PCBHandle handle ;
+    if ( idx < this -> generations . size() )
+    {
+        handle . index = idx ;
+        handle . generation = this -> generations[ idx ] ;
+    }
+    return handle ;
+}
+
+/**
+ * @brief Get the PCB a handle refers to.
+ * @param handle: the handle
+ * @return PCB*: the PCB, or nullptr if it has been removed or replaced
+ * since the handle was made
+ */
+PCB* PCBTable::resolve( const PCBHandle& handle ) const
+{
+    if ( handle . index >= this -> generations . size()
+        or handle . generation % 2 == 0
+        or this -> generations[ handle . index ] != handle . generation )
+        return nullptr ;
+    return this -> storage == PCBStorage::HEAP
+        ? this -> table[ handle . index ]
+        : &this -> slabs[ handle . index / SLAB_SIZE ][ handle . index % SLAB_SIZE ] ;
+}
+
+/**
+ * @brief Remove the PCB a handle refers to from the table and destroy it.
+ * Its index is not reused by allocate(); see release().
+ * @param handle: the handle
+ * @return bool: true if the PCB was removed, false if the handle was stale
+ */
+bool PCBTable::destroyPCB( const PCBHandle& handle )
+{
+    if ( this -> resolve( handle ) == nullptr )
+        return false ;
+    if ( this -> storage == PCBStorage::HEAP )
+    {
+        delete this -> table[ handle . index ] ;
+        this -> table[ handle . index ] = nullptr ;
+    }
+    this -> vacate( handle . index ) ;
+    return true ;
+}
+
+/**
+ * @brief Create a PCB at a free index, growing the table if it is full.
+ * The index is also the new PCB's ID. Runs in O(1), amortized over growth.
+ * @param priority Priority of the new PCB
+ * @return PCBHandle: a handle to the new PCB, or one that never resolves
+ * if all MAX_CAPACITY slots are in use
+ */
+PCBHandle PCBTable::allocate( const unsigned& priority )
+{
+    unsigned idx = this -> generations . size() ;
+    // Released indexes are reused first. One may have been filled by
+    // addNewPCB since it was released, in which case it is skipped.
+    while ( not this -> free_ids . empty() and idx == this -> generations . size() )
+    {
+        unsigned candidate = this -> free_ids . back() ;
+        this -> free_ids . pop_back() ;
+        if ( this -> generations[ candidate ] % 2 == 0 )
+            idx = candidate ;
+    }
+    // Otherwise the next fresh index is used, skipping any that were filled
+    // by addNewPCB. Each index is passed over at most once.
+    if ( idx == this -> generations . size() )
+    {
+        while ( this -> next_fresh < this -> generations . size()
+            and this -> generations[ this -> next_fresh ] % 2 )
+            ++ this -> next_fresh ;
+        if ( this -> next_fresh >= MAX_CAPACITY ) // The table is full
+            return PCBHandle() ;
+        idx = this -> next_fresh ++ ;
+    }
+    return this -> addNewPCB( idx, priority, idx ) ;
+}
+
+/**
+ * @brief Destroy the PCB a handle refers to and give its index back to
+ * allocate().
+ * @param handle: the handle
+ * @return bool: true if the PCB was released, false if the handle was stale
+ */
+bool PCBTable::release( const PCBHandle& handle )
+{
+    if ( not this -> destroyPCB( handle ) )
+        return false ;
+    this -> free_ids . push_back( handle . index ) ;
+    return true ;
+}
+
+/**
+ * @brief Make room for at least n slots, up to MAX_CAPACITY. The table at
+ * least doubles each time it grows, short of that limit. PCBs and handles
+ * stay valid.
+ * @param n: the number of slots needed
+ */
+void PCBTable::reserve( const unsigned& n )
+{
+    if ( n <= this -> generations . size() 
+        or this -> generations . size() >= MAX_CAPACITY )
+        return ;
+    // Doubling is capped before it can overflow.
+    unsigned new_capacity = this -> generations . size() < MAX_CAPACITY / 2
+        ? this -> generations . size() * 2 
+        : MAX_CAPACITY ;
+    if ( new_capacity < n )
+        new_capacity = n < MAX_CAPACITY ? n : MAX_CAPACITY ;
+    this -> generations . resize( new_capacity ) ;
+    // Only the tables of pointers move. Heap PCBs and slabs stay where they
+    // are, so pointers to PCBs stay valid too.
+    if ( this -> storage == PCBStorage::HEAP )
+        this -> table . resize( new_capacity ) ;
+    else
+        this -> slabs . resize( ( new_capacity + SLAB_SIZE - 1 ) / SLAB_SIZE ) ;
+}
+
+/**
+ * @brief Get the number of slots in the table.
+ * @return unsigned: the capacity of the table
+ */
+unsigned PCBTable::capacity() const
+{
+    return this -> generations . size() ;
+}
+
+/**
+ * @brief Get the number of PCBs in the table.
+ * @return unsigned: the number of occupied slots
+ */
+unsigned PCBTable::size() const
+{
+    return this -> live ;
+}
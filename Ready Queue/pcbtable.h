@@ -1,70 +1,237 @@
-/**
- * Assignment 1: priority queue of processes
- * @file pcbtable.h
- * @author Corey Talbert
- * @brief This is the header file for the PCBTable class, an array(list) of all PCB elements in the system..
- * @version 0.1
- * @date 09-19-2022
- */
-
-#pragma once
-#include "pcb.h"
-#include <vector>
-
-/**
- * @brief PCTable is an array of all PCB's in the system.
- */
-class PCBTable {
-private:
-    vector<PCB*> table ;
-
-public:
-    /**
-     * @brief Construct a new PCBTable object of the given size (number of PCBs)
-     * @param size: the capacity of the PCBTable
-     */
-    PCBTable( const int& size = 100 ) ;
-
-    /**
-     * @brief Destroy the PCBTable object. Make sure to delete all the PCBs in the table.
-     */
-    ~PCBTable() ;
-
-    /**
-     * @brief Get the PCB at index "idx" of the PCBTable.
-     * @param idx: the index of the PCB to get
-     * @return PCB*: pointer to the PCB at index "idx"
-     */
-    PCB* getPCB( const unsigned& idx ) const ;
-
-    /**
-     * @brief Overload of the operator [] that returns the PCB at idx
-     * @param idx: The ID number of the wanted process
-     * @return PCB*
-     */
-    PCB* operator[]( const unsigned& idx ) const 
-    {
-        return getPCB( idx );
-    }
-
-    /**
-     * @brief Add a PCB to the PCBTable at index idx.
-     * @param pcb: the PCB to add
-     * @param idx: the index to add the PCB at
-     */
-    void addPCB( PCB *pcb, const unsigned& idx ) ;
-
-    /**
-     * @brief Add a new PCB to the PCBTable.
-     * @param pid Id of the new PCB
-     * @param priority Priority of the new PCB
-     * @param idx The index of the new PCB in the PCBTable
-     */
-    void addNewPCB( const unsigned& pid, 
-                    const unsigned& priority, 
-                    const unsigned& idx )
-    {
-        PCB *pcb = new PCB( pid, priority ) ;
-        addPCB( pcb, idx ) ;
-    }
-} ;
\ No newline at end of file
+/**
+ * Assignment 1: priority queue of processes
+ * @file pcbtable.h
+ * @author Corey Talbert
+ * @brief This is the header file for the PCBTable class, an array(list) of all PCB elements in the system..
+ * @version 0.1
+ * @date 09-19-2022
+ */
+
+#pragma once
+#include "pcb.h"
+#include <vector>
+
+/**
+ * @brief Where a PCBTable keeps its PCBs.
+ * HEAP: the table holds pointers to individually allocated PCBs.
+ * SLAB: the PCBs live inside the table, in contiguous slabs of PCBTable::SLAB_SIZE.
+ */
+enum class PCBStorage { HEAP, SLAB };
+
+/**
+ * @brief A reference to a PCB in a PCBTable that can tell when it has gone
+ * stale. Each slot of the table counts how many times a PCB has been put in
+ * it or removed from it; a handle remembers the count for its PCB, so a
+ * handle to a PCB that has since been destroyed, or replaced by another one,
+ * no longer resolves.
+ */
+struct PCBHandle
+{
+    // The index of the PCB in the table.
+    unsigned index = 0 ;
+    // The generation of the slot when the handle was made. Live PCBs have
+    // odd generations, so the default handle never resolves.
+    unsigned generation = 0 ;
+} ;
+
+/**
+ * @brief PCTable is an array of all PCB's in the system.
+ */
+class PCBTable {
+public:
+    /**
+     * @brief The number of PCBs in one slab of SLAB storage.
+     */
+    static const unsigned SLAB_SIZE = 1024 ;
+
+    /**
+     * @brief The most slots a table can have. Indexes from here up are
+     * rejected, so a stray ID cannot make the table allocate gigabytes or
+     * wrap idx + 1 around to 0.
+     */
+    static const unsigned MAX_CAPACITY = 1u << 24 ;
+
+private:
+    vector<PCB*> table ;
+
+    /**
+     * @brief How the PCBs are stored.
+     */
+    PCBStorage storage ;
+
+    /**
+     * @brief The slabs of SLAB storage, each an array of SLAB_SIZE PCBs. A
+     * slab is allocated the first time one of its slots is used.
+     */
+    vector<PCB*> slabs ;
+
+    /**
+     * @brief The generation of each slot. It is odd while the slot holds a
+     * PCB and even while it is empty, and goes up by one on every change.
+     */
+    vector<unsigned> generations ;
+
+    /**
+     * @brief Indexes given back by release(), reused by allocate() before any
+     * fresh index.
+     */
+    vector<unsigned> free_ids ;
+
+    /**
+     * @brief allocate() hands out fresh indexes in increasing order from here.
+     */
+    unsigned next_fresh = 0 ;
+
+    /**
+     * @brief The number of slots holding a PCB.
+     */
+    unsigned live = 0 ;
+
+    /**
+     * @brief Get the slot of a PCB in SLAB storage, allocating its slab if
+     * needed.
+     * @param idx The index of the slot.
+     * @return PCB*: the slot
+     */
+    PCB* slot( const unsigned& idx ) ;
+
+    /**
+     * @brief Check whether a PCB lives in one of the slabs of SLAB storage.
+     * @param pcb The PCB.
+     * @return bool: true if pcb points into a slab
+     */
+    bool inSlab( const PCB* pcb ) const ;
+
+    /**
+     * @brief Mark a slot as holding a new PCB.
+     * @param idx The index of the slot.
+     */
+    void occupy( const unsigned& idx ) ;
+
+    /**
+     * @brief Mark a slot as empty.
+     * @param idx The index of the slot.
+     */
+    void vacate( const unsigned& idx ) ;
+
+public:
+    /**
+     * @brief Construct a new PCBTable object of the given size (number of PCBs)
+     * @param size: the capacity of the PCBTable
+     * @param storage: whether PCBs are allocated one by one or kept in slabs
+     */
+    PCBTable( const int& size = 100 , const PCBStorage& storage = PCBStorage::HEAP ) ;
+
+    /**
+     * @brief Destroy the PCBTable object. Make sure to delete all the PCBs in the table.
+     */
+    ~PCBTable() ;
+
+    PCBTable( const PCBTable& ) = delete ;
+    PCBTable& operator=( const PCBTable& ) = delete ;
+
+    /**
+     * @brief Get the PCB at index "idx" of the PCBTable.
+     * @param idx: the index of the PCB to get
+     * @return PCB*: pointer to the PCB at index "idx", or nullptr if there is none
+     */
+    PCB* getPCB( const unsigned& idx ) const ;
+
+    /**
+     * @brief Overload of the operator [] that returns the PCB at idx
+     * @param idx: The ID number of the wanted process
+     * @return PCB*
+     */
+    PCB* operator[]( const unsigned& idx ) const 
+    {
+        return getPCB( idx );
+    }
+
+    /**
+     * @brief Add a PCB to the PCBTable at index idx, growing the table if idx
+     * is past its end. The table takes ownership of the PCB. In HEAP storage
+     * a different PCB already at idx is deleted. In SLAB storage the PCB is
+     * copied into the slab and the caller's pointer is deleted, unless it
+     * points into the table's own slabs, in which case it is only copied.
+     * Either way a pointer that is deleted must not still be in a ReadyQueue.
+     * @param pcb: the PCB to add
+     * @param idx: the index to add the PCB at
+     * @return bool: true if the PCB was added, false if idx is not below
+     * MAX_CAPACITY, in which case the caller keeps the PCB
+     */
+    bool addPCB( PCB *pcb, const unsigned& idx ) ;
+
+    /**
+     * @brief Add a new PCB to the PCBTable, growing the table if idx is past
+     * its end. A PCB already at idx is destroyed.
+     * @param pid Id of the new PCB
+     * @param priority Priority of the new PCB
+     * @param idx The index of the new PCB in the PCBTable
+     * @return PCBHandle: a handle to the new PCB, or one that never resolves
+     * if idx is not below MAX_CAPACITY
+     */
+    PCBHandle addNewPCB( const unsigned& pid, 
+                         const unsigned& priority, 
+                         const unsigned& idx ) ;
+
+    /**
+     * @brief Get a handle to the PCB at index idx.
+     * @param idx: the index of the PCB
+     * @return PCBHandle: a handle to the PCB, which does not resolve if there
+     * is no PCB at idx
+     */
+    PCBHandle getHandle( const unsigned& idx ) const ;
+
+    /**
+     * @brief Get the PCB a handle refers to.
+     * @param handle: the handle
+     * @return PCB*: the PCB, or nullptr if it has been removed or replaced
+     * since the handle was made
+     */
+    PCB* resolve( const PCBHandle& handle ) const ;
+
+    /**
+     * @brief Remove the PCB a handle refers to from the table and destroy it.
+     * Its index is not reused by allocate(); see release().
+     * @param handle: the handle
+     * @return bool: true if the PCB was removed, false if the handle was stale
+     */
+    bool destroyPCB( const PCBHandle& handle ) ;
+
+    /**
+     * @brief Create a PCB at a free index, growing the table if it is full.
+     * The index is also the new PCB's ID. Runs in O(1), amortized over growth.
+     * @param priority Priority of the new PCB
+     * @return PCBHandle: a handle to the new PCB, or one that never resolves
+     * if all MAX_CAPACITY slots are in use
+     */
+    PCBHandle allocate( const unsigned& priority = MIN_PRIORITY ) ;
+
+    /**
+     * @brief Destroy the PCB a handle refers to and give its index back to
+     * allocate().
+     * @param handle: the handle
+     * @return bool: true if the PCB was released, false if the handle was stale
+     */
+    bool release( const PCBHandle& handle ) ;
+
+    /**
+     * @brief Make room for at least n slots, up to MAX_CAPACITY. The table
+     * at least doubles each time it grows, short of that limit. PCBs and
+     * handles stay valid.
+     * @param n: the number of slots needed
+     */
+    void reserve( const unsigned& n ) ;
+
+    /**
+     * @brief Get the number of slots in the table.
+     * @return unsigned: the capacity of the table
+     */
+    unsigned capacity() const ;
+
+    /**
+     * @brief Get the number of PCBs in the table.
+     * @return unsigned: the number of occupied slots
+     */
+    unsigned size() const ;
+} ;
@@ -0,0 +1,265 @@
+/**
+ * Assignment 1: priority queue of processes
+ * @file percpu_scheduler.cpp
+ * @author Corey Talbert
+ * @brief Implementation of percpu_scheduler.h with a mutex per CPU queue.
+ * @date 09-19-2022
+ */
+#include "percpu_scheduler.h"
+#include <chrono>
+
+/**
+ * @brief Get the current time of the monotonic clock.
+ * @return unsigned long: nanoseconds since an arbitrary epoch
+ */
+static unsigned long nowNanoseconds()
+{
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::steady_clock::now().time_since_epoch() ).count() ;
+}
+
+/**
+ * @brief Construct an empty CPU.
+ */
+PerCPUScheduler::CPU::CPU()
+    : top( 0 ) , depth( 0 ) , dispatches( 0 ) , steals( 0 ) , migrations( 0 ) , idle_ns( 0 )
+{
+    pthread_mutex_init( &this -> mutex , NULL ) ;
+}
+
+/**
+ * @brief Destroy a CPU.
+ */
+PerCPUScheduler::CPU::~CPU()
+{
+    pthread_mutex_destroy( &this -> mutex ) ;
+}
+
+/**
+ * @brief Construct a runtime with empty queues.
+ * @param cpu_count The number of simulated CPUs.
+ * @param balance_interval Dispatches between automatic balance passes, or
+ * 0 to only balance when balance() is called.
+ */
+PerCPUScheduler::PerCPUScheduler( unsigned cpu_count , unsigned balance_interval )
+    : cpus( new CPU[ cpu_count ] ) , cpu_count( cpu_count ) ,
+    balance_interval( balance_interval ) , since_balance( 0 )
+{
+    pthread_mutex_init( &this -> balance_mutex , NULL ) ;
+}
+
+/**
+ * @brief Destructor
+ */
+PerCPUScheduler::~PerCPUScheduler()
+{
+    pthread_mutex_destroy( &this -> balance_mutex ) ;
+}
+
+/**
+ * @brief Get the number of CPUs.
+ * @return unsigned: the number of CPUs
+ */
+unsigned PerCPUScheduler::getCPUCount() const
+{
+    return this -> cpu_count ;
+}
+
+/**
+ * @brief Refresh the unlocked copies of a CPU's top priority and depth.
+ * Called with the CPU's mutex held.
+ * @param cpu The CPU whose queue changed.
+ */
+void PerCPUScheduler::publish( CPU& cpu )
+{
+    cpu . top . store( cpu . queue . topPriority() , std::memory_order_relaxed ) ;
+    cpu . depth . store( cpu . queue . size() , std::memory_order_relaxed ) ;
+}
+
+/**
+ * @brief Add a PCB to the ready queue of a CPU.
+ * @param cpu The index of the CPU.
+ * @param pcbPtr The PCB to add.
+ */
+void PerCPUScheduler::addPCB( unsigned cpu , PCB* pcbPtr )
+{
+    CPU& c = this -> cpus[ cpu ] ;
+    pthread_mutex_lock( &c . mutex ) ;
+    c . queue . addPCB( pcbPtr ) ;
+    this -> publish( c ) ;
+    pthread_mutex_unlock( &c . mutex ) ;
+}
+
+/**
+ * @brief Dispatch the next PCB on a CPU: the highest priority PCB of its
+ * own queue or, if that is empty, one stolen from another CPU.
+ * @param cpu The index of the CPU.
+ * @return PCB*: the PCB to run, or nullptr if there is no work anywhere
+ */
+PCB* PerCPUScheduler::removePCB( unsigned cpu )
+{
+    CPU& c = this -> cpus[ cpu ] ;
+    PCB* result = nullptr ;
+    // The local queue is checked without its mutex first, so an idle CPU
+    // polling for work does not keep taking its own lock.
+    if ( c . depth . load( std::memory_order_relaxed ) > 0 )
+    {
+        pthread_mutex_lock( &c . mutex ) ;
+        result = c . queue . removePCB() ;
+        this -> publish( c ) ;
+        pthread_mutex_unlock( &c . mutex ) ;
+    }
+    if ( result == nullptr )
+        result = this -> steal( cpu ) ;
+
+    // Idle time runs from the first dispatch that found no work to the next
+    // one that did.
+    if ( result == nullptr )
+    {
+        if ( c . idle_since == 0 )
+            c . idle_since = nowNanoseconds() ;
+        return nullptr ;
+    }
+    if ( c . idle_since != 0 )
+    {
+        c . idle_ns . fetch_add( nowNanoseconds() - c . idle_since , std::memory_order_relaxed ) ;
+        c . idle_since = 0 ;
+    }
+    c . dispatches . fetch_add( 1 , std::memory_order_relaxed ) ;
+
+    // Every balance_interval dispatches, the CPU that resets the count runs
+    // a balance pass.
+    if ( this -> balance_interval != 0
+        and this -> since_balance . fetch_add( 1 , std::memory_order_relaxed ) + 1 >= this -> balance_interval
+        and this -> since_balance . exchange( 0 , std::memory_order_relaxed ) >= this -> balance_interval )
+        this -> balance() ;
+    return result ;
+}
+
+/**
+ * @brief Take the highest priority PCB queued on any other CPU.
+ * @param thief The index of the CPU that ran dry.
+ * @return PCB*: the stolen PCB, or nullptr if every other CPU is empty
+ */
+PCB* PerCPUScheduler::steal( unsigned thief )
+{
+    for ( ;; )
+    {
+        // The victim is the CPU whose next PCB has the highest priority.
+        unsigned victim = this -> cpu_count ;
+        unsigned best = 0 ;
+        for ( unsigned i = 0 ; i < this -> cpu_count ; ++i )
+        {
+            unsigned top = this -> cpus[ i ] . top . load( std::memory_order_relaxed ) ;
+            if ( i != thief and this -> cpus[ i ] . depth . load( std::memory_order_relaxed ) > 0
+                and ( victim == this -> cpu_count or top > best ) )
+            {
+                victim = i ;
+                best = top ;
+            }
+        }
+        if ( victim == this -> cpu_count )
+            return nullptr ;
+
+        CPU& v = this -> cpus[ victim ] ;
+        pthread_mutex_lock( &v . mutex ) ;
+        PCB* result = v . queue . removePCB() ;
+        this -> publish( v ) ;
+        pthread_mutex_unlock( &v . mutex ) ;
+        if ( result != nullptr )
+        {
+            CPU& t = this -> cpus[ thief ] ;
+            t . steals . fetch_add( 1 , std::memory_order_relaxed ) ;
+            t . migrations . fetch_add( 1 , std::memory_order_relaxed ) ;
+            return result ;
+        }
+        // The victim was emptied before its lock was taken. Choose again.
+    }
+}
+
+/**
+ * @brief Move up to n PCBs from one CPU to another.
+ * @param from The index of the CPU to take from.
+ * @param to The index of the CPU to add to.
+ * @param n The number of PCBs to move.
+ * @return unsigned: the number of PCBs moved
+ */
+unsigned PerCPUScheduler::migrate( unsigned from , unsigned to , unsigned n )
+{
+    CPU& f = this -> cpus[ from ] ;
+    CPU& t = this -> cpus[ to ] ;
+    // Both locks are taken in index order so two migrations cannot deadlock.
+    pthread_mutex_t* first = from < to ? &f . mutex : &t . mutex ;
+    pthread_mutex_t* second = from < to ? &t . mutex : &f . mutex ;
+    pthread_mutex_lock( first ) ;
+    pthread_mutex_lock( second ) ;
+    unsigned moved = 0 ;
+    for ( PCB* pcb ; moved < n and ( pcb = f . queue . removePCB() ) != nullptr ; ++moved )
+        t . queue . addPCB( pcb ) ;
+    this -> publish( f ) ;
+    this -> publish( t ) ;
+    pthread_mutex_unlock( second ) ;
+    pthread_mutex_unlock( first ) ;
+    t . migrations . fetch_add( moved , std::memory_order_relaxed ) ;
+    return moved ;
+}
+
+/**
+ * @brief Even out the queue depths by moving PCBs from the deepest queues
+ * to the shallowest until no two differ by more than one.
+ * @return unsigned: the number of PCBs moved
+ */
+unsigned PerCPUScheduler::balance()
+{
+    pthread_mutex_lock( &this -> balance_mutex ) ;
+    unsigned total = 0 ;
+    // Each pass halves the gap between the deepest and shallowest queue.
+    // The depths read are snapshots, so the pass count is capped in case
+    // other threads keep refilling the queues.
+    for ( unsigned pass = 0 ; pass < 2 * this -> cpu_count ; ++pass )
+    {
+        unsigned deepest = 0 , shallowest = 0 ;
+        for ( unsigned i = 1 ; i < this -> cpu_count ; ++i )
+        {
+            int d = this -> cpus[ i ] . depth . load( std::memory_order_relaxed ) ;
+            if ( d > this -> cpus[ deepest ] . depth . load( std::memory_order_relaxed ) )
+                deepest = i ;
+            if ( d < this -> cpus[ shallowest ] . depth . load( std::memory_order_relaxed ) )
+                shallowest = i ;
+        }
+        int gap = this -> cpus[ deepest ] . depth . load( std::memory_order_relaxed )
+            - this -> cpus[ shallowest ] . depth . load( std::memory_order_relaxed ) ;
+        if ( gap <= 1 )
+            break ;
+        total += this -> migrate( deepest , shallowest , gap / 2 ) ;
+    }
+    pthread_mutex_unlock( &this -> balance_mutex ) ;
+    return total ;
+}
+
+/**
+ * @brief Get the number of PCBs queued on a CPU.
+ * @param cpu The index of the CPU.
+ * @return int: the number of PCBs in its ready queue
+ */
+int PerCPUScheduler::size( unsigned cpu ) const
+{
+    return this -> cpus[ cpu ] . depth . load( std::memory_order_relaxed ) ;
+}
+
+/**
+ * @brief Get the counters of a CPU. An idle period still in progress is
+ * not counted until the CPU dispatches again.
+ * @param cpu The index of the CPU.
+ * @return CPUCounters: dispatches, steals, migrations and idle time
+ */
+CPUCounters PerCPUScheduler::getCounters( unsigned cpu ) const
+{
+    const CPU& c = this -> cpus[ cpu ] ;
+    CPUCounters counters ;
+    counters . dispatches = c . dispatches . load( std::memory_order_relaxed ) ;
+    counters . steals = c . steals . load( std::memory_order_relaxed ) ;
+    counters . migrations = c . migrations . load( std::memory_order_relaxed ) ;
+    counters . idle_ns = c . idle_ns . load( std::memory_order_relaxed ) ;
+    return counters ;
+}
@@ -0,0 +1,179 @@
+/**
+ * Assignment 1: priority queue of processes
+ * @file percpu_scheduler.h
+ * @author Corey Talbert
+ * @brief PerCPUScheduler gives each simulated CPU its own ReadyQueue. An idle
+ * CPU steals the highest priority PCB from another CPU, and a periodic
+ * balancer evens out the queue depths.
+ * @version 0.1
+ * @date 09-19-2022
+ */
+
+#pragma once
+#include <atomic>
+#include <memory>
+#include <pthread.h>
+#include "readyqueue.h"
+
+/**
+ * @brief Counters kept for each CPU.
+ */
+struct CPUCounters
+{
+    // The number of PCBs dispatched by the CPU.
+    unsigned long dispatches = 0 ;
+    // The number of PCBs the CPU took from another CPU when it ran dry.
+    unsigned long steals = 0 ;
+    // The number of PCBs moved onto the CPU from another CPU, by stealing or
+    // by the balancer.
+    unsigned long migrations = 0 ;
+    // The total time the CPU found no work, in nanoseconds.
+    unsigned long idle_ns = 0 ;
+} ;
+
+/**
+ * @brief A multi-queue scheduler runtime. Each CPU adds to and dispatches from
+ * its own ReadyQueue, so CPUs only contend when one of them steals or when
+ * the queues are balanced. removePCB( cpu ) is meant to be called only by the
+ * thread simulating that CPU; the other functions may be called from any
+ * thread.
+ */
+class PerCPUScheduler
+{
+private:
+
+    /**
+     * @brief The run queue and counters of one CPU, aligned to a cache line so
+     * CPUs do not share lines.
+     */
+    struct alignas( 64 ) CPU
+    {
+        // Guards queue.
+        pthread_mutex_t mutex ;
+        // The PCBs ready to run on this CPU.
+        ReadyQueue<> queue ;
+        // Copies of the queue's top priority and size, readable without the
+        // mutex when choosing a victim or balancing.
+        std::atomic<unsigned> top ;
+        std::atomic<int> depth ;
+        // The counters reported by getCounters.
+        std::atomic<unsigned long> dispatches ;
+        std::atomic<unsigned long> steals ;
+        std::atomic<unsigned long> migrations ;
+        std::atomic<unsigned long> idle_ns ;
+        // When the CPU last went idle, in nanoseconds, or 0 while it has work.
+        unsigned long idle_since = 0 ;
+
+        CPU() ;
+        ~CPU() ;
+    } ;
+
+    /**
+     * @brief The CPUs.
+     */
+    std::unique_ptr<CPU[]> cpus ;
+
+    /**
+     * @brief The number of CPUs.
+     */
+    unsigned cpu_count = 0 ;
+
+    /**
+     * @brief Dispatches between automatic balance passes, or 0 to only balance
+     * when balance() is called.
+     */
+    unsigned balance_interval = 0 ;
+
+    /**
+     * @brief Dispatches since the last automatic balance pass.
+     */
+    std::atomic<unsigned> since_balance ;
+
+    /**
+     * @brief Held by the thread running a balance pass.
+     */
+    pthread_mutex_t balance_mutex ;
+
+    /**
+     * @brief Refresh the unlocked copies of a CPU's top priority and depth.
+     * Called with the CPU's mutex held.
+     * @param cpu The CPU whose queue changed.
+     */
+    void publish( CPU& cpu ) ;
+
+    /**
+     * @brief Take the highest priority PCB queued on any other CPU.
+     * @param thief The index of the CPU that ran dry.
+     * @return PCB*: the stolen PCB, or nullptr if every other CPU is empty
+     */
+    PCB* steal( unsigned thief ) ;
+
+    /**
+     * @brief Move up to n PCBs from one CPU to another.
+     * @param from The index of the CPU to take from.
+     * @param to The index of the CPU to add to.
+     * @param n The number of PCBs to move.
+     * @return unsigned: the number of PCBs moved
+     */
+    unsigned migrate( unsigned from , unsigned to , unsigned n ) ;
+
+public:
+    /**
+     * @brief Construct a runtime with empty queues.
+     * @param cpu_count The number of simulated CPUs.
+     * @param balance_interval Dispatches between automatic balance passes, or
+     * 0 to only balance when balance() is called.
+     */
+    PerCPUScheduler( unsigned cpu_count , unsigned balance_interval = 0 ) ;
+
+    /**
+     * @brief Destructor
+     */
+    ~PerCPUScheduler() ;
+
+    PerCPUScheduler( const PerCPUScheduler& ) = delete ;
+    PerCPUScheduler& operator=( const PerCPUScheduler& ) = delete ;
+
+    /**
+     * @brief Get the number of CPUs.
+     * @return unsigned: the number of CPUs
+     */
+    unsigned getCPUCount() const ;
+
+    /**
+     * @brief Add a PCB to the ready queue of a CPU.
+     * @param cpu The index of the CPU.
+     * @param pcbPtr The PCB to add.
+     */
+    void addPCB( unsigned cpu , PCB* pcbPtr ) ;
+
+    /**
+     * @brief Dispatch the next PCB on a CPU: the highest priority PCB of its
+     * own queue or, if that is empty, one stolen from another CPU.
+     * @param cpu The index of the CPU.
+     * @return PCB*: the PCB to run, or nullptr if there is no work anywhere
+     */
+    PCB* removePCB( unsigned cpu ) ;
+
+    /**
+     * @brief Even out the queue depths by moving PCBs from the deepest queues
+     * to the shallowest until no two differ by more than one.
+     * @return unsigned: the number of PCBs moved
+     */
+    unsigned balance() ;
+
+    /**
+     * @brief Get the number of PCBs queued on a CPU.
+     * @param cpu The index of the CPU.
+     * @return int: the number of PCBs in its ready queue
+     */
+    int size( unsigned cpu ) const ;
+
+    /**
+     * @brief Get the counters of a CPU. An idle period still in progress is
+     * not counted until the CPU dispatches again.
+     * @param cpu The index of the CPU.
+     * @return CPUCounters: dispatches, steals, migrations and idle time
+     */
+    CPUCounters getCounters( unsigned cpu ) const ;
+} ; // End of class PerCPUScheduler
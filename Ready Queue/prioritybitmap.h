@@ -0,0 +1,186 @@
+/**
+ * Assignment 1: priority queue of processes
+ * @file prioritybitmap.h
+ * @author Corey Talbert
+ * @brief PriorityBitmap records which priority levels of a ReadyQueue are
+ * occupied and finds the highest one. Up to 64 levels it is a single word;
+ * beyond that it is a hierarchy of words with a summary bit per word, so the
+ * lookup costs one count-leading-zeros per level of the hierarchy.
+ * @version 0.1
+ * @date 09-19-2022
+ */
+
+#pragma once
+#include <cstdint>
+
+/**
+ * @brief An occupancy bitmap of BITS bits.
+ */
+template <unsigned BITS, bool SINGLE = ( BITS <= 64 )>
+class PriorityBitmap ;
+
+/**
+ * @brief A bitmap of up to 64 bits, held in one word.
+ */
+template <unsigned BITS>
+class PriorityBitmap<BITS, true>
+{
+private:
+    /**
+     * @brief Bit i is set exactly when level i is occupied.
+     */
+    uint64_t word = 0 ;
+
+public:
+    /**
+     * @brief Mark level i occupied.
+     * @param i The level.
+     */
+    void set( unsigned i )
+    {
+        this -> word |= uint64_t( 1 ) << i ;
+    }
+
+    /**
+     * @brief Mark level i empty.
+     * @param i The level.
+     */
+    void clear( unsigned i )
+    {
+        this -> word &= ~( uint64_t( 1 ) << i ) ;
+    }
+
+    /**
+     * @brief Check if level i is occupied.
+     * @param i The level.
+     * @return bool: True if level i is occupied, otherwise false.
+     */
+    bool test( unsigned i ) const
+    {
+        return this -> word >> i & 1 ;
+    }
+
+    /**
+     * @brief Check if no level is occupied.
+     * @return bool: True if every level is empty, otherwise false.
+     */
+    bool empty() const
+    {
+        return this -> word == 0 ;
+    }
+
+    /**
+     * @brief Find the highest occupied level. The bitmap must not be empty.
+     * @return unsigned: the highest occupied level
+     */
+    unsigned highest() const
+    {
+        return 63 - __builtin_clzll( this -> word ) ;
+    }
+
+    /**
+     * @brief Find the highest occupied level below level i.
+     * @param i The level, less than BITS.
+     * @return int: the highest occupied level below i, or -1 if there is none
+     */
+    int highestBelow( unsigned i ) const
+    {
+        uint64_t below = this -> word & ( ( uint64_t( 1 ) << i ) - 1 ) ;
+        return below ? 63 - __builtin_clzll( below ) : -1 ;
+    }
+} ;
+
+/**
+ * @brief A bitmap of more than 64 bits. The bits are held in words, and a
+ * smaller bitmap has bit w set exactly when word w is non-zero.
+ */
+template <unsigned BITS>
+class PriorityBitmap<BITS, false>
+{
+private:
+    /**
+     * @brief The number of words holding the bits.
+     */
+    static const unsigned WORDS = ( BITS + 63 ) / 64 ;
+
+    /**
+     * @brief Bit i % 64 of words[ i / 64 ] is set exactly when level i is
+     * occupied.
+     */
+    uint64_t words[ WORDS ] = {} ;
+
+    /**
+     * @brief Bit w is set exactly when words[ w ] is non-zero.
+     */
+    PriorityBitmap<WORDS> summary ;
+
+public:
+    /**
+     * @brief Mark level i occupied.
+     * @param i The level.
+     */
+    void set( unsigned i )
+    {
+        this -> words[ i / 64 ] |= uint64_t( 1 ) << i % 64 ;
+        this -> summary . set( i / 64 ) ;
+    }
+
+    /**
+     * @brief Mark level i empty.
+     * @param i The level.
+     */
+    void clear( unsigned i )
+    {
+        this -> words[ i / 64 ] &= ~( uint64_t( 1 ) << i % 64 ) ;
+        if ( this -> words[ i / 64 ] == 0 )
+            this -> summary . clear( i / 64 ) ;
+    }
+
+    /**
+     * @brief Check if level i is occupied.
+     * @param i The level.
+     * @return bool: True if level i is occupied, otherwise false.
+     */
+    bool test( unsigned i ) const
+    {
+        return this -> words[ i / 64 ] >> i % 64 & 1 ;
+    }
+
+    /**
+     * @brief Check if no level is occupied.
+     * @return bool: True if every level is empty, otherwise false.
+     */
+    bool empty() const
+    {
+        return this -> summary . empty() ;
+    }
+
+    /**
+     * @brief Find the highest occupied level. The bitmap must not be empty.
+     * @return unsigned: the highest occupied level
+     */
+    unsigned highest() const
+    {
+        unsigned w = this -> summary . highest() ;
+        return w * 64 + 63 - __builtin_clzll( this -> words[ w ] ) ;
+    }
+
+    /**
+     * @brief Find the highest occupied level below level i.
+     * @param i The level, less than BITS.
+     * @return int: the highest occupied level below i, or -1 if there is none
+     */
+    int highestBelow( unsigned i ) const
+    {
+        // First the lower bits of i's own word, then the highest non-empty
+        // word below it.
+        unsigned w = i / 64 ;
+        uint64_t below = this -> words[ w ] & ( ( uint64_t( 1 ) << i % 64 ) - 1 ) ;
+        if ( below )
+            return w * 64 + 63 - __builtin_clzll( below ) ;
+        int lower = this -> summary . highestBelow( w ) ;
+        return lower < 0
+            ? -1
+            : lower * 64 + 63 - __builtin_clzll( this -> words[ lower ] ) ;
+    }
+} ;
@@ -1,156 +1,1039 @@
-/**
- * Assignment 1: priority queue of processes
- * @file readyqueue.h
- * @author Corey Talbert
- * @brief ReadyQueue is a queue of PCB's that are in the READY state to be scheduled to run.
- * It should be a priority queue such that the process with the highest priority can be selected next.
- * @version 0.1
- * @date 09-19-2022
- */
-
-#pragma once
-#include "pcb.h"
-
-
-/**
- * @brief A queue of PCB's that are in the READY state to be scheduled to run.
- * It should be a priority queue such that the process with the highest priority can be selected next.
- */
-class ReadyQueue 
-{
-private:
-
-    /** 
-     * @brief A queue-like, FIFO, singly-linked list of PCB pointers
-     * representing an ordered list of processes at the same priority level.
-     * The ReadyQueue class is implemented as an array of these lists.
-     */
-    class List
-    {
-    private:
-        
-        /** 
-         * @brief A simple liked list node with a forward link 
-         * and a PCB pointer payload. 
-         */
-        struct Node
-        {
-            PCB* data = nullptr ;
-            Node* next = nullptr ;
-        } ;
-        
-        /** 
-         * @brief The front and oldest element of the list. 
-         */
-        Node* head = nullptr ;
-        
-        /** 
-         * @brief The end and newest element of the list. 
-         */
-        Node* tail = nullptr ;
-        
-        /** 
-         * @brief The number of elements in the list. 
-         */
-        unsigned size = 0 ;
-    
-    public:
-        /**
-         * @brief Construct an empty list. 
-         */
-        List() ;
-        
-        /** 
-         * @brief Destroy a list. 
-         */
-        ~List() ;
-        
-        /** 
-         * @brief Check if the list is empty.
-         * @return bool: True if the list is empty, otherwise false.
-         */
-        bool isEmpty() const ;    
-        
-        /** 
-         * @brief Get the rq_size member.
-         * @return unsigned: the number of PCB pointers in the list.
-         */
-        unsigned getSize() const ;
-        
-        /**
-         * @brief Call the display method on each PCB pointed to in the list.
-         * @return void
-         */
-        void display() const ;
-        
-        /**
-         * @brief Reset the list to an empty state.
-         */
-        void clear() ;
-        
-        /**
-         * @brief Remove the front (head) node from the list.
-         * @return PCB*: The payload member in the head node.
-         */
-        PCB* popFront() ;
-    
-        /**
-         * @brief Add a node to the end of the list.
-         * @param new_data The PCB pointer to be held by the node.
-         */
-        void append( PCB* new_data ) ;
-
-    } ; // End of class List
-    
-    /**
-     * @brief The table of ordered, FIFO priority lists.
-     * The table is one bigger than MAX_PRIORITY for 
-     * ease of indexing / self-care / harm reduction. 
-     */
-    List rq[ MAX_PRIORITY + 1 ] ;
-    
-    /** 
-     * @brief The index of the highest priority non-empty list.
-     */
-    unsigned top = 0 ;
-
-    /**
-     * @brief The number of PCB pointers in the queue.
-     */
-    unsigned rq_size = 0 ;
-
-public:
-    /**
-     * @brief Construct a new ReadyQueue object
-     */
-    ReadyQueue() ;
-
-    /**
-     * @brief Destructor
-     */
-    ~ReadyQueue() ;
-
-    /**
-     * @brief Add a PCB representing a process into the ready queue.
-     * @param pcbPtr: the pointer to the PCB to be added
-     */
-	void addPCB( PCB* pcbPtr ) ;
-
-    /**
-     * @brief Remove and return the PCB with the highest priority from the queue
-     * @return PCB*: the pointer to the PCB with the highest priority
-     */
-	PCB* removePCB() ;
-
-    /**
-     * @brief Returns the number of elements in the queue.
-     * @return int: the number of PCBs in the queue
-     */
-	int size() ;
-
-     /**
-      * @brief Display the PCBs in the queue.
-      */
-	void displayAll() ;
-
-}; // End of class ReadyQueue
\ No newline at end of file
+/**
+ * Assignment 1: priority queue of processes
+ * @file readyqueue.h
+ * @author Corey Talbert
+ * @brief ReadyQueue is a queue of PCB's that are in the READY state to be scheduled to run.
+ * It should be a priority queue such that the process with the highest priority can be selected next.
+ * With aging on, a PCB's effective priority rises with the number of
+ * epochs of dispatches it has waited through, so low priority PCBs cannot
+ * starve. Aging is computed lazily from a rotating ring of list fronts, so
+ * adding and removing stay O(1) amortized whatever the rate and cap.
+ * @version 0.1
+ * @date 09-19-2022
+ */
+
+#pragma once
+#include <vector>
+#include "idmap.h"
+#include "pcb.h"
+#include "pcblist.h"
+#include "prioritybitmap.h"
+#include "readyqueue_stats.h"
+
+/**
+ * @brief One PCB of a ReadyQueue snapshot: a plain copy of the fields a
+ * monitor needs, safe to keep after the PCB has left the queue.
+ */
+struct ReadyQueueEntry
+{
+    unsigned priority ;
+    unsigned id ;
+    ProcState state ;
+} ;
+
+/**
+ * @brief A queue of PCB's that are in the READY state to be scheduled to run.
+ * It should be a priority queue such that the process with the highest priority can be selected next.
+ * @tparam LEVELS The number of priority levels. PCB priorities must be less
+ * than LEVELS. The default holds priorities up to MAX_PRIORITY.
+ */
+template <unsigned LEVELS = MAX_PRIORITY + 1>
+class ReadyQueue 
+{
+private:
+
+    /**
+     * @brief The FIFO list holding the PCBs of one priority level.
+     */
+    typedef PCBList List ;
+    
+    /**
+     * @brief The table of ordered, FIFO priority lists, indexed by priority.
+     * The default table is one bigger than MAX_PRIORITY for 
+     * ease of indexing / self-care / harm reduction. 
+     */
+    List rq[ LEVELS ] ;
+
+    /**
+     * @brief The pool shared by every list in the table, so enqueue and
+     * dequeue recycle nodes instead of calling new and delete.
+     */
+    List::Pool node_pool ;
+
+    /**
+     * @brief The occupancy bitmap of the table. Bit p is set exactly when
+     * rq[ p ] is non-empty, so the highest priority non-empty list is found
+     * with a count-leading-zeros per bitmap level instead of a downward scan.
+     * Up to 64 levels this is a single word.
+     */
+    PriorityBitmap<LEVELS> occupancy ;
+    
+    /** 
+     * @brief The index of the highest priority non-empty list.
+     */
+    unsigned top = 0 ;
+
+    /**
+     * @brief Recompute top from the occupancy bitmap.
+     */
+    void updateTop() ;
+
+    /**
+     * @brief The number of PCB pointers in the queue.
+     */
+    unsigned rq_size = 0 ;
+
+#ifndef READYQUEUE_INTRUSIVE
+    /**
+     * @brief The node of each queued PCB indexed by PCB ID, or nullptr. This
+     * stands in for a back-pointer in PCBs that have no link field, so the
+     * IDs of queued PCBs must be unique. The table only grows to cover IDs
+     * below twice the queue's size plus DENSE_SLACK, so its size follows
+     * the number of PCBs queued rather than the largest ID.
+     */
+    std::vector<List::Node*> nodes ;
+
+    /**
+     * @brief The node of each queued PCB whose ID was past the end of nodes
+     * when it was queued.
+     */
+    IDMap<List::Node*> sparse_nodes ;
+
+    /**
+     * @brief IDs below this always get a slot in nodes, however short the
+     * queue.
+     */
+    static const unsigned DENSE_SLACK = 1024 ;
+
+    /**
+     * @brief Record the node of a PCB that has just been queued.
+     * @param id: the ID of the PCB
+     * @param node: its node
+     */
+    void track( const unsigned& id , List::Node* node ) ;
+
+    /**
+     * @brief Forget the node of a PCB that has left the queue.
+     * @param id: the ID of the PCB
+     */
+    void untrack( const unsigned& id ) ;
+#endif
+
+    /**
+     * @brief Find the list node of a PCB.
+     * @param pcbPtr: the PCB
+     * @return List::Node*: the node, or nullptr if the PCB is not in the queue
+     */
+    List::Node* find( PCB* pcbPtr ) const ;
+
+#ifdef READYQUEUE_STATS
+    /**
+     * @brief The wait time and depth histograms.
+     */
+    ReadyQueueStats<LEVELS> stats ;
+#endif
+
+    /**
+     * @brief The number of PCBs removePCB has dispatched. This is the virtual
+     * time that aging is measured in.
+     */
+    unsigned long clock = 0 ;
+
+    /**
+     * @brief Dispatches per aging epoch, or 0 if aging is off.
+     */
+    unsigned aging_rate = 0 ;
+
+    /**
+     * @brief The current aging epoch, clock / aging_rate, and the number of
+     * dispatches left before the next one. Kept as the clock runs so that
+     * removal does not divide.
+     */
+    unsigned long epoch = 0 ;
+    unsigned epoch_left = 0 ;
+
+    /**
+     * @brief The largest aging boost a PCB can get, at most LEVELS.
+     */
+    unsigned aging_cap = 0 ;
+
+    /**
+     * @brief The number of buckets in the aging ring. A front below the cap
+     * has an effective priority of at most LEVELS + aging_cap - 2, and one
+     * that reached the cap since the last removal one more, so with the cap
+     * at most LEVELS every front in the ring has its own bucket.
+     */
+    static const unsigned RING = 2 * LEVELS ;
+
+    /**
+     * @brief Marks the end of a bucket, or a list that is in no bucket.
+     */
+    static const unsigned NO_LIST = LEVELS ;
+
+    /**
+     * @brief Where the front of one list is kept in the aging ring.
+     */
+    struct Front
+    {
+        // The epoch the front was queued in.
+        unsigned long queued ;
+        // The bucket, or RING if the list is empty or its front is capped.
+        unsigned bucket ;
+        // The lists before and after it in the bucket, or NO_LIST.
+        unsigned prev ;
+        unsigned next ;
+    } ;
+
+    /**
+     * @brief The first and last list of a bucket of the aging ring.
+     */
+    struct Bucket
+    {
+        unsigned head ;
+        unsigned tail ;
+    } ;
+
+    /**
+     * @brief Where the front of each list is, indexed by priority. Only
+     * sized while aging is on.
+     */
+    std::vector<Front> fronts ;
+
+    /**
+     * @brief The buckets of the aging ring. The front of list p, queued in
+     * epoch e and below the cap, is in bucket ( p - e ) % RING, and its
+     * effective priority in epoch E is ( bucket + E ) % RING. A new epoch so
+     * raises every front below the cap by one without moving any of them.
+     */
+    std::vector<Bucket> buckets ;
+
+    /**
+     * @brief Bit i is set exactly when bucket i is non-empty.
+     */
+    PriorityBitmap<RING> ring_occupancy ;
+
+    /**
+     * @brief Bit p is set exactly when the front of list p has reached the
+     * cap, so its effective priority is p + aging_cap.
+     */
+    PriorityBitmap<LEVELS> capped ;
+
+    /**
+     * @brief Get the effective priority of a queued node: its base priority
+     * plus one for every epoch of aging_rate dispatches that has started
+     * since it was queued, up to aging_cap.
+     * @param priority: the base priority of the node
+     * @param node: the node
+     * @return unsigned long: the effective priority
+     */
+    unsigned long effective( const unsigned& priority , const List::Node* node ) const ;
+
+    /**
+     * @brief Put the front of a non-empty list into the aging ring, or into
+     * capped if it has reached the cap.
+     * @param priority: the priority of the list
+     * @param queued: the epoch the front was queued in
+     */
+    void indexFront( const unsigned& priority , const unsigned long& queued ) ;
+
+    /**
+     * @brief Take the front of a list out of the aging ring or capped.
+     * @param priority: the priority of the list
+     */
+    void unindexFront( const unsigned& priority ) ;
+
+    /**
+     * @brief Find the list whose front PCB has the highest effective
+     * priority: the better of the highest ring bucket and the highest capped
+     * list. Fronts found in the ring that have reached the cap since they
+     * were put there are moved to capped first. Each front moves at most
+     * once, so this is O(1) amortized.
+     * @return unsigned: the priority of the list
+     */
+    unsigned agedTop() ;
+
+    /**
+     * @brief Take a node out of its list, keeping the occupancy bitmap, top
+     * and rq_size up to date.
+     * @param priority: the priority of the list holding the node
+     * @param node: the node
+     * @return PCB*: the PCB held by the node
+     */
+    PCB* detach( const unsigned& priority , List::Node* node ) ;
+
+public:
+    /**
+     * @brief Construct a new ReadyQueue object
+     */
+    ReadyQueue() ;
+
+    /**
+     * @brief Destructor
+     */
+    ~ReadyQueue() ;
+
+    /**
+     * @brief Add a PCB representing a process into the ready queue.
+     * @param pcbPtr: the pointer to the PCB to be added
+     * @return bool: true if the PCB was added, false if it is already
+     * queued, in which case nothing was done
+     */
+	bool addPCB( PCB* pcbPtr ) ;
+
+    /**
+     * @brief Remove and return the PCB with the highest priority from the
+     * queue. With aging on, this is the highest effective priority. PCBs of
+     * one base priority always leave oldest first, but a tie between base
+     * priorities may go to either PCB, not always the one that has waited
+     * longest. O(1), amortized with aging on.
+     * @return PCB*: the pointer to the PCB with the highest priority
+     */
+	PCB* removePCB() ;
+
+    /**
+     * @brief Turn aging on or off. Dispatches are counted in epochs of rate,
+     * and every epoch that starts while a PCB is queued raises its effective
+     * priority by one, up to cap. A PCB queued part way through an epoch so
+     * gets its first point up to rate - 1 dispatches early. Base priorities
+     * are never changed. Removal stays O(1) amortized (see bench_readyqueue).
+     * This rebuilds the aging index, in O(LEVELS).
+     * @param rate: dispatches per epoch, or 0 to turn aging off
+     * @param cap: the largest boost. A cap above LEVELS is taken as LEVELS,
+     * which already lifts every capped PCB over every base priority.
+     */
+    void setAging( const unsigned& rate , const unsigned& cap ) ;
+
+    /**
+     * @brief Get the effective priority of a PCB, computed from how long it
+     * has been queued.
+     * @param pcbPtr: the pointer to the PCB
+     * @return unsigned long: the effective priority, or the base priority if
+     * the PCB is not queued or aging is off
+     */
+    unsigned long effectivePriority( PCB* pcbPtr ) const ;
+
+    /**
+     * @brief Add a range of PCBs to the queue. The occupancy bitmap is
+     * updated once per run of equal priorities, and top and the size once
+     * per batch. PCBs already queued, including ones earlier in the range,
+     * are skipped.
+     * @param first: iterator to the first PCB pointer
+     * @param last: iterator past the last PCB pointer
+     * @return unsigned: the number of PCBs added
+     */
+    template <class Iterator>
+    unsigned addPCBs( Iterator first , Iterator last ) ;
+
+    /**
+     * @brief Remove up to k PCBs in priority order, as k calls of removePCB
+     * would. Whole runs are taken from the front of each list, and top and
+     * the size are updated once per batch.
+     * @param k: the largest number of PCBs to remove
+     * @param out: where the removed PCB pointers are written, room for k
+     * @return unsigned: the number of PCBs removed
+     */
+    unsigned removeTop( const unsigned& k , PCB** out ) ;
+
+    /**
+     * @brief Remove a PCB from anywhere in the queue in O(1). Its state is
+     * left for the caller to set.
+     * @param pcbPtr: the pointer to the PCB to be removed
+     * @return bool: true if the PCB was removed, false if it was not queued
+     */
+    bool remove( PCB* pcbPtr ) ;
+
+    /**
+     * @brief Change the priority of a PCB in O(1). A queued PCB moves to the
+     * back of its new priority list. The priority of a queued PCB must only
+     * be changed through here.
+     * @param pcbPtr: the pointer to the PCB
+     * @param priority: the new priority
+     * @return bool: true if the PCB was queued, false if only its priority
+     * was changed
+     */
+    bool changePriority( PCB* pcbPtr , const unsigned& priority ) ;
+
+    /**
+     * @brief Returns the number of elements in the queue.
+     * @return int: the number of PCBs in the queue
+     */
+	int size() ;
+
+    /**
+     * @brief Get the priority of the PCB that removePCB would return next.
+     * With aging on, removePCB may instead return an aged PCB of lower base
+     * priority.
+     * @return unsigned: the highest priority in the queue, or 0 if it is empty
+     */
+    unsigned topPriority() const ;
+
+     /**
+      * @brief Display the PCBs in the queue.
+      */
+	void displayAll() ;
+
+    /**
+     * @brief Call a visitor on every queued PCB, from the highest priority
+     * down and oldest first within a priority: the order removePCB takes them
+     * with aging off. Nothing is allocated or printed.
+     * @param visit: called as visit( const PCB& ) for each PCB
+     */
+    template <class Visitor>
+    void forEach( Visitor visit ) const ;
+
+    /**
+     * @brief Copy the priority, ID and state of queued PCBs, in the order of
+     * forEach, into a buffer. Nothing is allocated or printed.
+     * @param buffer: where the entries are written
+     * @param capacity: the number of entries the buffer has room for
+     * @return unsigned: the number of entries written, at most capacity
+     */
+    unsigned snapshot( ReadyQueueEntry* buffer , const unsigned& capacity ) const ;
+
+    /**
+     * @brief Get the usage statistics of the list node pool. All zero in
+     * intrusive mode.
+     * @return NodePoolStats: capacity, nodes in use, high-water mark and chunks
+     */
+    NodePoolStats getNodePoolStats() const ;
+
+#ifdef READYQUEUE_STATS
+    /**
+     * @brief Copy the wait time and depth histograms. Unlike the rest of the
+     * queue, this may be called from another thread while the queue is in use.
+     * @return ReadyQueueStatsSnapshot: the statistics of each used level
+     */
+    ReadyQueueStatsSnapshot getStats() const ;
+#endif
+
+}; // End of class ReadyQueue
+
+/**
+ * @brief Constructor for the ReadyQueue class.
+ */
+template <unsigned LEVELS>
+ReadyQueue<LEVELS>::ReadyQueue()
+{}
+
+/**
+ * @brief Destructor
+ */
+template <unsigned LEVELS>
+ReadyQueue<LEVELS>::~ReadyQueue() 
+{
+    for ( List& l : this -> rq )
+    {
+        l . clear( this -> node_pool ) ;
+    }
+}
+
+/**
+ * @brief Add a PCB representing a process into the ready queue.
+ * @param pcbPtr: the pointer to the PCB to be added
+ * @return bool: true if the PCB was added, false if it is already
+ * queued, in which case nothing was done
+ */
+template <unsigned LEVELS>
+bool ReadyQueue<LEVELS>::addPCB( PCB* pcbPtr ) 
+{
+    // Linking a queued PCB again would overwrite the links of its node, or
+    // in intrusive mode of the PCB itself, and corrupt its list.
+    if ( this -> find( pcbPtr ) )
+        return false ;
+    pcbPtr->setState( ProcState::READY ) ;
+    unsigned new_priority = pcbPtr -> getPriority() ;
+    List::Node* node = rq[ new_priority ] . append( pcbPtr , this -> node_pool ) ;
+#ifndef READYQUEUE_INTRUSIVE
+    this -> track( pcbPtr -> getID() , node ) ;
+#endif
+    node -> enqueued_at = this -> clock ;
+#ifdef READYQUEUE_STATS
+    node -> enqueued_ns = this -> stats . now() ;
+    this -> stats . added( new_priority , rq[ new_priority ] . getSize() ) ;
+#endif
+    // Only the front of a list is aged; a PCB behind it cannot overtake it.
+    if ( this -> aging_rate and rq[ new_priority ] . getSize() == 1 )
+        this -> indexFront( new_priority , this -> epoch ) ;
+    this -> occupancy . set( new_priority ) ;
+    ++ this -> rq_size ;
+    // If the new PCB has the highest priority in the queue, update top.
+    if ( this -> top < new_priority )
+    {
+        this -> top = new_priority ;
+    }
+    return true ;
+}
+
+/**
+ * @brief Remove and return the PCB with the highest priority from the queue.
+ * O(1), amortized with aging on.
+ * @return PCB*: the pointer to the PCB with the highest priority
+ */
+template <unsigned LEVELS>
+PCB* ReadyQueue<LEVELS>::removePCB()
+{
+    PCB* result = nullptr ;
+    if ( this -> rq_size > 0 )
+    {
+        unsigned from = this -> aging_rate ? this -> agedTop() : this -> top ;
+        List::Node* node = rq[ from ] . front() ;
+#ifdef READYQUEUE_STATS
+        this -> stats . dispatched( from , this -> stats . now() - node -> enqueued_ns ) ;
+#endif
+        result = this -> detach( from , node ) ;
+        result -> setState( ProcState::RUNNING ) ;
+        ++ this -> clock ;
+        if ( this -> aging_rate and -- this -> epoch_left == 0 )
+        {
+            ++ this -> epoch ;
+            this -> epoch_left = this -> aging_rate ;
+        }
+    }
+    return result ;
+}
+
+/**
+ * @brief Turn aging on or off. Every epoch of rate dispatches that starts
+ * while a PCB is queued raises its effective priority by one, up to cap.
+ * Base priorities are never changed. This rebuilds the aging index, in
+ * O(LEVELS).
+ * @param rate: dispatches per epoch, or 0 to turn aging off
+ * @param cap: the largest boost, taken as LEVELS if above it
+ */
+template <unsigned LEVELS>
+void ReadyQueue<LEVELS>::setAging( const unsigned& rate , const unsigned& cap )
+{
+    this -> aging_rate = rate ;
+    // Effective priorities below the cap must fit in the ring.
+    this -> aging_cap = cap < LEVELS ? cap : LEVELS ;
+    this -> ring_occupancy = PriorityBitmap<RING>() ;
+    this -> capped = PriorityBitmap<LEVELS>() ;
+    this -> fronts . assign( rate ? LEVELS : 0 , Front{ 0 , RING , NO_LIST , NO_LIST } ) ;
+    this -> buckets . assign( rate ? RING : 0 , Bucket{ NO_LIST , NO_LIST } ) ;
+    if ( rate == 0 )
+        return ;
+    this -> epoch = this -> clock / rate ;
+    this -> epoch_left = rate - this -> clock % rate ;
+    if ( this -> rq_size == 0 )
+        return ;
+    for ( int p = this -> top ; p >= 0 ; p = this -> occupancy . highestBelow( p ) )
+        this -> indexFront( p , rq[ p ] . front() -> enqueued_at / rate ) ;
+}
+
+/**
+ * @brief Get the effective priority of a PCB, computed from how long it
+ * has been queued.
+ * @param pcbPtr: the pointer to the PCB
+ * @return unsigned long: the effective priority, or the base priority if
+ * the PCB is not queued or aging is off
+ */
+template <unsigned LEVELS>
+unsigned long ReadyQueue<LEVELS>::effectivePriority( PCB* pcbPtr ) const
+{
+    const List::Node* node = this -> find( pcbPtr ) ;
+    if ( node == nullptr )
+        return pcbPtr -> getPriority() ;
+    return this -> effective( pcbPtr -> getPriority() , node ) ;
+}
+
+/**
+ * @brief Get the effective priority of a queued node: its base priority
+ * plus one for every epoch of aging_rate dispatches that has started since
+ * it was queued, up to aging_cap.
+ * @param priority: the base priority of the node
+ * @param node: the node
+ * @return unsigned long: the effective priority
+ */
+template <unsigned LEVELS>
+unsigned long ReadyQueue<LEVELS>::effective( const unsigned& priority , const List::Node* node ) const
+{
+    if ( this -> aging_rate == 0 )
+        return priority ;
+    unsigned long boost = this -> epoch - node -> enqueued_at / this -> aging_rate ;
+    return priority + ( boost < this -> aging_cap ? boost : this -> aging_cap ) ;
+}
+
+/**
+ * @brief Put the front of a non-empty list into the aging ring, or into
+ * capped if it has reached the cap.
+ * @param priority: the priority of the list
+ * @param queued: the epoch the front was queued in
+ */
+template <unsigned LEVELS>
+void ReadyQueue<LEVELS>::indexFront( const unsigned& priority , const unsigned long& queued )
+{
+    Front& front = this -> fronts[ priority ] ;
+    front . queued = queued ;
+    if ( this -> epoch - queued >= this -> aging_cap )
+    {
+        this -> capped . set( priority ) ;
+        return ;
+    }
+    unsigned i = ( priority + RING - queued % RING ) % RING ;
+    Bucket& bucket = this -> buckets[ i ] ;
+    front . bucket = i ;
+    front . next = NO_LIST ;
+    if ( this -> ring_occupancy . test( i ) )
+    {
+        front . prev = bucket . tail ;
+        this -> fronts[ bucket . tail ] . next = priority ;
+    }
+    else
+    {
+        front . prev = NO_LIST ;
+        bucket . head = priority ;
+        this -> ring_occupancy . set( i ) ;
+    }
+    bucket . tail = priority ;
+}
+
+/**
+ * @brief Take the front of a list out of the aging ring or capped.
+ * @param priority: the priority of the list
+ */
+template <unsigned LEVELS>
+void ReadyQueue<LEVELS>::unindexFront( const unsigned& priority )
+{
+    Front& front = this -> fronts[ priority ] ;
+    if ( front . bucket == RING )
+    {
+        this -> capped . clear( priority ) ;
+        return ;
+    }
+    Bucket& bucket = this -> buckets[ front . bucket ] ;
+    if ( front . prev == NO_LIST )
+        bucket . head = front . next ;
+    else
+        this -> fronts[ front . prev ] . next = front . next ;
+    if ( front . next == NO_LIST )
+        bucket . tail = front . prev ;
+    else
+        this -> fronts[ front . next ] . prev = front . prev ;
+    if ( bucket . head == NO_LIST )
+        this -> ring_occupancy . clear( front . bucket ) ;
+    front . bucket = RING ;
+}
+
+/**
+ * @brief Find the list whose front PCB has the highest effective
+ * priority: the better of the highest ring bucket and the highest capped
+ * list. Fronts found in the ring that have reached the cap since they were
+ * put there are moved to capped first. Each front moves at most once, so
+ * this is O(1) amortized.
+ * @return unsigned: the priority of the list
+ */
+template <unsigned LEVELS>
+unsigned ReadyQueue<LEVELS>::agedTop()
+{
+    // Each list is FIFO, so its front has waited longest and has the
+    // highest effective priority in the list.
+    unsigned long epoch = this -> epoch ;
+    unsigned best = this -> top ;
+    unsigned long best_priority = 0 ;
+    bool ringed = false ;
+    // Bucket last holds effective priority RING - 1 in this epoch, and the
+    // ones below it in rotation hold the priorities below that.
+    unsigned last = RING - 1 - epoch % RING ;
+    while ( not this -> ring_occupancy . empty() )
+    {
+        int i = this -> ring_occupancy . test( last ) ? last : this -> ring_occupancy . highestBelow( last ) ;
+        if ( i < 0 )
+            i = this -> ring_occupancy . highest() ;
+        unsigned p = this -> buckets[ i ] . head ;
+        if ( epoch - this -> fronts[ p ] . queued < this -> aging_cap )
+        {
+            best = p ;
+            best_priority = ( i + epoch ) % RING ;
+            ringed = true ;
+            break ;
+        }
+        // Moving capped fronts out of the top buckets on every removal keeps
+        // the ring priority of every front left in it below RING, so no
+        // front wraps around into a bucket it does not belong in.
+        this -> unindexFront( p ) ;
+        this -> capped . set( p ) ;
+    }
+    // Ties go to the older front.
+    if ( not this -> capped . empty() )
+    {
+        unsigned p = this -> capped . highest() ;
+        unsigned long priority = p + this -> aging_cap ;
+        if ( not ringed or priority > best_priority or ( priority == best_priority
+            and rq[ p ] . front() -> enqueued_at < rq[ best ] . front() -> enqueued_at ) )
+            best = p ;
+    }
+    return best ;
+}
+
+/**
+ * @brief Add a range of PCBs to the queue. The occupancy bitmap is
+ * updated once per run of equal priorities, and top and the size once
+ * per batch. PCBs already queued, including ones earlier in the range,
+ * are skipped.
+ * @param first: iterator to the first PCB pointer
+ * @param last: iterator past the last PCB pointer
+ * @return unsigned: the number of PCBs added
+ */
+template <unsigned LEVELS>
+template <class Iterator>
+unsigned ReadyQueue<LEVELS>::addPCBs( Iterator first , Iterator last )
+{
+    unsigned count = 0 ;
+    unsigned highest = this -> top ;
+    unsigned previous = 0 ;
+#ifdef READYQUEUE_STATS
+    unsigned long now = this -> stats . now() ;
+#endif
+    for ( ; first != last ; ++first )
+    {
+        PCB* pcbPtr = *first ;
+        if ( this -> find( pcbPtr ) )
+            continue ;
+        pcbPtr -> setState( ProcState::READY ) ;
+        unsigned new_priority = pcbPtr -> getPriority() ;
+        List::Node* node = rq[ new_priority ] . append( pcbPtr , this -> node_pool ) ;
+#ifndef READYQUEUE_INTRUSIVE
+        this -> track( pcbPtr -> getID() , node ) ;
+#endif
+        node -> enqueued_at = this -> clock ;
+#ifdef READYQUEUE_STATS
+        node -> enqueued_ns = now ;
+        this -> stats . added( new_priority , rq[ new_priority ] . getSize() ) ;
+#endif
+        if ( this -> aging_rate and rq[ new_priority ] . getSize() == 1 )
+            this -> indexFront( new_priority , this -> epoch ) ;
+        // A run of equal priorities needs the bit set only once.
+        if ( count == 0 or new_priority != previous )
+        {
+            this -> occupancy . set( new_priority ) ;
+            previous = new_priority ;
+            if ( highest < new_priority )
+                highest = new_priority ;
+        }
+        ++ count ;
+    }
+    this -> rq_size += count ;
+    this -> top = highest ;
+    return count ;
+}
+
+/**
+ * @brief Remove up to k PCBs in priority order, as k calls of removePCB
+ * would. Whole runs are taken from the front of each list, and top and
+ * the size are updated once per batch.
+ * @param k: the largest number of PCBs to remove
+ * @param out: where the removed PCB pointers are written, room for k
+ * @return unsigned: the number of PCBs removed
+ */
+template <unsigned LEVELS>
+unsigned ReadyQueue<LEVELS>::removeTop( const unsigned& k , PCB** out )
+{
+    unsigned n = 0 ;
+    // With aging on, every removal can come from a different list.
+    if ( this -> aging_rate )
+    {
+        while ( n < k and this -> rq_size > 0 )
+            out[ n++ ] = this -> removePCB() ;
+        return n ;
+    }
+
+    unsigned level = this -> top ;
+#ifdef READYQUEUE_STATS
+    unsigned long now = this -> stats . now() ;
+#endif
+    while ( n < k and n < this -> rq_size )
+    {
+#ifdef READYQUEUE_STATS
+        // The nodes are returned to the pool by popFront, so their stamps
+        // are read first.
+        unsigned i = n ;
+        for ( List::Node* itr = rq[ level ] . front() ; itr and i < k ; itr = itr -> next , ++i )
+            this -> stats . dispatched( level , now - itr -> enqueued_ns ) ;
+#endif
+        unsigned run = rq[ level ] . popFront( k - n , out + n , this -> node_pool ) ;
+        for ( unsigned i = n ; i < n + run ; ++i )
+        {
+            out[ i ] -> setState( ProcState::RUNNING ) ;
+#ifndef READYQUEUE_INTRUSIVE
+            this -> untrack( out[ i ] -> getID() ) ;
+#endif
+        }
+        n += run ;
+        // A drained list is cleared from the bitmap and the walk continues
+        // at the next non-empty list below it.
+        if ( rq[ level ] . isEmpty() )
+        {
+            this -> occupancy . clear( level ) ;
+            int below = this -> occupancy . highestBelow( level ) ;
+            level = below < 0 ? 0 : below ;
+        }
+    }
+    this -> rq_size -= n ;
+    this -> top = level ;
+    this -> clock += n ;
+    return n ;
+}
+
+/**
+ * @brief Remove a PCB from anywhere in the queue in O(1). Its state is
+ * left for the caller to set.
+ * @param pcbPtr: the pointer to the PCB to be removed
+ * @return bool: true if the PCB was removed, false if it was not queued
+ */
+template <unsigned LEVELS>
+bool ReadyQueue<LEVELS>::remove( PCB* pcbPtr )
+{
+    List::Node* node = this -> find( pcbPtr ) ;
+    if ( node == nullptr )
+        return false ;
+    this -> detach( pcbPtr -> getPriority() , node ) ;
+    return true ;
+}
+
+/**
+ * @brief Change the priority of a PCB in O(1). A queued PCB moves to the
+ * back of its new priority list. The priority of a queued PCB must only
+ * be changed through here.
+ * @param pcbPtr: the pointer to the PCB
+ * @param priority: the new priority
+ * @return bool: true if the PCB was queued, false if only its priority
+ * was changed
+ */
+template <unsigned LEVELS>
+bool ReadyQueue<LEVELS>::changePriority( PCB* pcbPtr , const unsigned& priority )
+{
+#ifdef READYQUEUE_STATS
+    // Moving to another list does not restart the PCB's wait.
+    List::Node* old_node = this -> find( pcbPtr ) ;
+    unsigned long enqueued_ns = old_node ? old_node -> enqueued_ns : 0 ;
+#endif
+    bool queued = this -> remove( pcbPtr ) ;
+    pcbPtr -> setPriority( priority ) ;
+    if ( queued )
+    {
+        this -> addPCB( pcbPtr ) ;
+#ifdef READYQUEUE_STATS
+        this -> find( pcbPtr ) -> enqueued_ns = enqueued_ns ;
+#endif
+    }
+    return queued ;
+}
+
+/**
+ * @brief Find the list node of a PCB.
+ * @param pcbPtr: the PCB
+ * @return List::Node*: the node, or nullptr if the PCB is not in the queue
+ */
+template <unsigned LEVELS>
+PCBList::Node* ReadyQueue<LEVELS>::find( PCB* pcbPtr ) const
+{
+#ifdef READYQUEUE_INTRUSIVE
+    // A queued PCB has a previous PCB unless it is the front of its list.
+    unsigned priority = pcbPtr -> getPriority() ;
+    if ( priority < LEVELS and ( pcbPtr -> prev or rq[ priority ] . front() == pcbPtr ) )
+        return pcbPtr ;
+    return nullptr ;
+#else
+    unsigned id = pcbPtr -> getID() ;
+    List::Node* node = nullptr ;
+    if ( id < this -> nodes . size() )
+        node = this -> nodes[ id ] ;
+    // A PCB queued while the table was too short to hold its ID stays in
+    // the map even after the table has grown past it.
+    if ( node == nullptr )
+        node = this -> sparse_nodes . get( id ) ;
+    if ( node and node -> data == pcbPtr )
+        return node ;
+    return nullptr ;
+#endif
+}
+
+#ifndef READYQUEUE_INTRUSIVE
+/**
+ * @brief Record the node of a PCB that has just been queued.
+ * @param id: the ID of the PCB
+ * @param node: its node
+ */
+template <unsigned LEVELS>
+void ReadyQueue<LEVELS>::track( const unsigned& id , List::Node* node )
+{
+    if ( id < this -> nodes . size() )
+        this -> nodes[ id ] = node ;
+    // The bound is checked before id + 1 is taken, so no ID can wrap it.
+    else if ( id < 2 * this -> rq_size + DENSE_SLACK )
+    {
+        this -> nodes . resize( id + 1 ) ;
+        this -> nodes[ id ] = node ;
+    }
+    else
+        this -> sparse_nodes . set( id , node ) ;
+}
+
+/**
+ * @brief Forget the node of a PCB that has left the queue.
+ * @param id: the ID of the PCB
+ */
+template <unsigned LEVELS>
+void ReadyQueue<LEVELS>::untrack( const unsigned& id )
+{
+    if ( id < this -> nodes . size() and this -> nodes[ id ] )
+        this -> nodes[ id ] = nullptr ;
+    else
+        this -> sparse_nodes . erase( id ) ;
+}
+#endif
+
+/**
+ * @brief Take a node out of its list, keeping the occupancy bitmap, top
+ * and rq_size up to date.
+ * @param priority: the priority of the list holding the node
+ * @param node: the node
+ * @return PCB*: the PCB held by the node
+ */
+template <unsigned LEVELS>
+PCB* ReadyQueue<LEVELS>::detach( const unsigned& priority , List::Node* node )
+{
+    // Taking the front of a list out puts the next PCB in its place.
+    bool front = this -> aging_rate and rq[ priority ] . front() == node ;
+    if ( front )
+        this -> unindexFront( priority ) ;
+    PCB* result = rq[ priority ] . unlink( node , this -> node_pool ) ;
+    if ( front and not rq[ priority ] . isEmpty() )
+        this -> indexFront( priority , rq[ priority ] . front() -> enqueued_at / this -> aging_rate ) ;
+#ifndef READYQUEUE_INTRUSIVE
+    this -> untrack( result -> getID() ) ;
+#endif
+    -- this -> rq_size ;
+
+    // UPDATE TOP
+    // There are no more PCBs at this priority, so its bit is cleared. If it
+    // was the top, the next highest priority is read straight from the bitmap.
+    if ( rq[ priority ] . isEmpty() )
+    {
+        this -> occupancy . clear( priority ) ;
+        if ( priority == this -> top )
+            this -> updateTop() ;
+    }
+    return result ;
+}
+
+/**
+ * @brief Recompute top from the occupancy bitmap.
+ */
+template <unsigned LEVELS>
+void ReadyQueue<LEVELS>::updateTop()
+{
+    // The highest set bit is the highest priority non-empty list. An empty
+    // queue has no bits set, and top goes back to 0.
+    this -> top = this -> occupancy . empty()
+        ? 0
+        : this -> occupancy . highest() ;
+}
+
+/**
+ * @brief Returns the number of elements in the queue.
+ * @return int: the number of PCBs in the queue
+ */
+template <unsigned LEVELS>
+int ReadyQueue<LEVELS>::size() 
+{
+    return rq_size ;
+}
+
+/**
+ * @brief Get the priority of the PCB that removePCB would return next.
+ * @return unsigned: the highest priority in the queue, or 0 if it is empty
+ */
+template <unsigned LEVELS>
+unsigned ReadyQueue<LEVELS>::topPriority() const
+{
+    return this -> top ;
+}
+
+/**
+ * @brief Display the PCBs in the queue.
+ */
+template <unsigned LEVELS>
+void ReadyQueue<LEVELS>::displayAll() 
+{
+    puts("Display Processes in ReadyQueue:") ;
+    for ( unsigned i = LEVELS - 1 ; i >= MIN_PRIORITY ; --i )
+    {
+        if ( not rq[ i ] . isEmpty() ) 
+        {
+            rq[ i ] . display() ;
+        }
+    }
+}
+
+/**
+ * @brief Call a visitor on every queued PCB, from the highest priority
+ * down and oldest first within a priority: the order removePCB takes them
+ * with aging off. Nothing is allocated or printed.
+ * @param visit: called as visit( const PCB& ) for each PCB
+ */
+template <unsigned LEVELS>
+template <class Visitor>
+void ReadyQueue<LEVELS>::forEach( Visitor visit ) const
+{
+    if ( this -> rq_size == 0 )
+        return ;
+    // Only the non-empty lists are visited, found through the bitmap.
+    for ( int p = this -> top ; p >= 0 ; p = this -> occupancy . highestBelow( p ) )
+    {
+        for ( List::Node* itr = rq[ p ] . front() ; itr ; itr = itr -> next )
+            visit( static_cast<const PCB&>( *List::payload( itr ) ) ) ;
+    }
+}
+
+/**
+ * @brief Copy the priority, ID and state of queued PCBs, in the order of
+ * forEach, into a buffer. Nothing is allocated or printed.
+ * @param buffer: where the entries are written
+ * @param capacity: the number of entries the buffer has room for
+ * @return unsigned: the number of entries written, at most capacity
+ */
+template <unsigned LEVELS>
+unsigned ReadyQueue<LEVELS>::snapshot( ReadyQueueEntry* buffer , const unsigned& capacity ) const
+{
+    unsigned n = 0 ;
+    if ( this -> rq_size == 0 )
+        return 0 ;
+    // The same walk as forEach, but it stops as soon as the buffer is full.
+    for ( int p = this -> top ; p >= 0 and n < capacity ; p = this -> occupancy . highestBelow( p ) )
+    {
+        for ( List::Node* itr = rq[ p ] . front() ; itr and n < capacity ; itr = itr -> next )
+        {
+            const PCB* pcbPtr = List::payload( itr ) ;
+            buffer[ n ] . priority = p ;
+            buffer[ n ] . id = pcbPtr -> getID() ;
+            buffer[ n ] . state = pcbPtr -> getState() ;
+            ++n ;
+        }
+    }
+    return n ;
+}
+
+/**
+ * @brief Get the usage statistics of the list node pool. All zero in
+ * intrusive mode.
+ * @return NodePoolStats: capacity, nodes in use, high-water mark and chunks
+ */
+template <unsigned LEVELS>
+NodePoolStats ReadyQueue<LEVELS>::getNodePoolStats() const
+{
+    return this -> node_pool . getStats() ;
+}
+
+#ifdef READYQUEUE_STATS
+/**
+ * @brief Copy the wait time and depth histograms. Unlike the rest of the
+ * queue, this may be called from another thread while the queue is in use.
+ * @return ReadyQueueStatsSnapshot: the statistics of each used level
+ */
+template <unsigned LEVELS>
+ReadyQueueStatsSnapshot ReadyQueue<LEVELS>::getStats() const
+{
+    return this -> stats . snapshot() ;
+}
+#endif
@@ -0,0 +1,56 @@
+/**
+ * Assignment 1: priority queue of processes
+ * @file readyqueue_stats.cpp
+ * @author Corey Talbert
+ * @brief Reading and printing snapshots of ReadyQueue statistics.
+ * @date 09-19-2022
+ */
+
+#include <cstdio>
+#include "readyqueue_stats.h"
+
+/**
+ * @brief Get the lower bound of a wait time percentile, to the bucket.
+ * @param fraction: the percentile as a fraction, e.g. 0.99
+ * @return uint64_t: the smallest wait in ns of the bucket holding it
+ */
+uint64_t LevelStatsSnapshot::waitPercentile( const double& fraction ) const
+{
+    uint64_t total = 0 ;
+    for ( uint64_t c : this -> wait_counts )
+        total += c ;
+    uint64_t rank = fraction * total ;
+    uint64_t seen = 0 ;
+    for ( unsigned b = 0 ; b < this -> wait_counts . size() ; ++b )
+    {
+        seen += this -> wait_counts[ b ] ;
+        if ( seen > rank )
+            return LogLinearHistogram::lowerBound( b ) ;
+    }
+    return 0 ;
+}
+
+/**
+ * @brief Print wait percentiles and the depth histogram of each level.
+ */
+void ReadyQueueStatsSnapshot::display() const
+{
+    puts( "ReadyQueue statistics (wait in ns, bucket lower bounds):" ) ;
+    printf( "%-8s %10s %10s %10s %10s %10s %10s  depth histogram\n" ,
+            "priority" , "adds" , "dispatches" , "p50" , "p90" , "p99" , "p99.9" ) ;
+    for ( const LevelStatsSnapshot& level : this -> levels )
+    {
+        printf( "%-8u %10lu %10lu %10lu %10lu %10lu %10lu " , level . priority ,
+                ( unsigned long ) level . adds , ( unsigned long ) level . dispatches ,
+                ( unsigned long ) level . waitPercentile( 0.5 ) ,
+                ( unsigned long ) level . waitPercentile( 0.9 ) ,
+                ( unsigned long ) level . waitPercentile( 0.99 ) ,
+                ( unsigned long ) level . waitPercentile( 0.999 ) ) ;
+        // Each non-empty depth bucket as <lower bound>:<count>.
+        for ( unsigned d = 0 ; d < level . depth_counts . size() ; ++d )
+            if ( level . depth_counts[ d ] )
+                printf( " %lu:%lu" , d ? 1ul << ( d - 1 ) : 0ul ,
+                        ( unsigned long ) level . depth_counts[ d ] ) ;
+        putchar( '\n' ) ;
+    }
+}
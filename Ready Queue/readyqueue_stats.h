@@ -0,0 +1,242 @@
+/**
+ * Assignment 1: priority queue of processes
+ * @file readyqueue_stats.h
+ * @author Corey Talbert
+ * @brief Dwell-time and depth instrumentation for ReadyQueue. When built with
+ * READYQUEUE_STATS, ReadyQueue stamps each PCB as it is added, and on
+ * dispatch records how long it waited in a log-linear histogram per priority.
+ * It also records the depth of the list a PCB joins in a histogram per
+ * priority. Without READYQUEUE_STATS none of this is compiled in. The
+ * counters are written by the queue's thread only and can be snapshotted from
+ * any thread while the queue runs.
+ * @version 0.1
+ * @date 09-19-2022
+ */
+
+#pragma once
+#include <atomic>
+#include <cstdint>
+#include <ctime>
+#include <vector>
+
+/**
+ * @brief The wait times of one priority level, bucketed log-linearly: four
+ * buckets per power of two, so every bucket is within 25% of its value.
+ */
+class LogLinearHistogram
+{
+public:
+    /**
+     * @brief The number of linear buckets per power of two, as a power of two.
+     */
+    static const unsigned SUB_BITS = 2 ;
+
+    /**
+     * @brief The number of buckets, enough for any 64-bit value.
+     */
+    static const unsigned BUCKETS = ( 1 << SUB_BITS ) * ( 64 - SUB_BITS + 1 ) ;
+
+    /**
+     * @brief Get the bucket of a value.
+     * @param value: the value
+     * @return unsigned: the bucket
+     */
+    static unsigned bucketOf( const uint64_t& value )
+    {
+        if ( value < ( 1u << SUB_BITS ) )
+            return value ;
+        unsigned exponent = 63 - __builtin_clzll( value ) ;
+        unsigned sub = ( value >> ( exponent - SUB_BITS ) ) & ( ( 1u << SUB_BITS ) - 1 ) ;
+        return ( ( exponent - SUB_BITS + 1 ) << SUB_BITS ) + sub ;
+    }
+
+    /**
+     * @brief Get the smallest value of a bucket.
+     * @param bucket: the bucket
+     * @return uint64_t: the smallest value that falls in it
+     */
+    static uint64_t lowerBound( const unsigned& bucket )
+    {
+        if ( bucket < ( 1u << SUB_BITS ) )
+            return bucket ;
+        unsigned exponent = ( bucket >> SUB_BITS ) + SUB_BITS - 1 ;
+        uint64_t sub = bucket & ( ( 1u << SUB_BITS ) - 1 ) ;
+        return ( uint64_t( 1 ) << exponent ) | ( sub << ( exponent - SUB_BITS ) ) ;
+    }
+
+    /**
+     * @brief The count of each bucket.
+     */
+    std::atomic<uint64_t> counts[ BUCKETS ] = {} ;
+
+    /**
+     * @brief Count a value. Only one thread may record into a histogram, so
+     * the increment is a plain load and store, not a locked add.
+     * @param value: the value
+     */
+    void record( const uint64_t& value )
+    {
+        std::atomic<uint64_t>& c = this -> counts[ bucketOf( value ) ] ;
+        c . store( c . load( std::memory_order_relaxed ) + 1 , std::memory_order_relaxed ) ;
+    }
+} ;
+
+/**
+ * @brief A copy of the statistics of one priority level.
+ */
+struct LevelStatsSnapshot
+{
+    // The priority of the level.
+    unsigned priority = 0 ;
+    // The number of PCBs dispatched from, and added to, the level.
+    uint64_t dispatches = 0 ;
+    uint64_t adds = 0 ;
+    // The wait time histogram in ns, in LogLinearHistogram buckets.
+    std::vector<uint64_t> wait_counts ;
+    // depth_counts[ d ] counts adds that left the list with a depth whose
+    // highest set bit is d - 1, i.e. depth in [ 2^(d-1), 2^d ).
+    std::vector<uint64_t> depth_counts ;
+
+    /**
+     * @brief Get the lower bound of a wait time percentile, to the bucket.
+     * @param fraction: the percentile as a fraction, e.g. 0.99
+     * @return uint64_t: the smallest wait in ns of the bucket holding it
+     */
+    uint64_t waitPercentile( const double& fraction ) const ;
+} ;
+
+/**
+ * @brief A copy of the statistics of every level that has seen a PCB, in
+ * increasing priority.
+ */
+struct ReadyQueueStatsSnapshot
+{
+    std::vector<LevelStatsSnapshot> levels ;
+
+    /**
+     * @brief Print wait percentiles and the depth histogram of each level.
+     */
+    void display() const ;
+} ;
+
+/**
+ * @brief The statistics of one priority level.
+ */
+struct LevelStats
+{
+    LogLinearHistogram wait ;
+    std::atomic<uint64_t> depth[ 33 ] = {} ;
+    std::atomic<uint64_t> adds { 0 } ;
+    std::atomic<uint64_t> dispatches { 0 } ;
+
+    /**
+     * @brief Increment a counter written only by the queue's thread.
+     */
+    static void bump( std::atomic<uint64_t>& c )
+    {
+        c . store( c . load( std::memory_order_relaxed ) + 1 , std::memory_order_relaxed ) ;
+    }
+} ;
+
+/**
+ * @brief The statistics of a ReadyQueue of LEVELS priority levels. The
+ * statistics of a level are allocated the first time a PCB is added to it,
+ * so a queue with many levels only pays for the ones it uses.
+ */
+template <unsigned LEVELS>
+class ReadyQueueStats
+{
+private:
+    /**
+     * @brief The statistics of each level, or nullptr if it is unused.
+     * Published with release so a snapshotting thread sees them whole.
+     */
+    std::atomic<LevelStats*> levels[ LEVELS ] = {} ;
+
+    /**
+     * @brief Get the statistics of a level, allocating them if needed.
+     */
+    LevelStats& level( const unsigned& priority )
+    {
+        LevelStats* stats = this -> levels[ priority ] . load( std::memory_order_relaxed ) ;
+        if ( stats == nullptr )
+        {
+            stats = new LevelStats ;
+            this -> levels[ priority ] . store( stats , std::memory_order_release ) ;
+        }
+        return *stats ;
+    }
+
+public:
+    ReadyQueueStats() {}
+
+    ~ReadyQueueStats()
+    {
+        for ( std::atomic<LevelStats*>& stats : this -> levels )
+            delete stats . load() ;
+    }
+
+    ReadyQueueStats( const ReadyQueueStats& ) = delete ;
+    ReadyQueueStats& operator=( const ReadyQueueStats& ) = delete ;
+
+    /**
+     * @brief Read the clock the PCBs are stamped with.
+     * @return uint64_t: nanoseconds of CLOCK_MONOTONIC_RAW
+     */
+    static uint64_t now()
+    {
+        timespec ts ;
+        clock_gettime( CLOCK_MONOTONIC_RAW , &ts ) ;
+        return uint64_t( ts . tv_sec ) * 1000000000 + ts . tv_nsec ;
+    }
+
+    /**
+     * @brief Record an add to a level.
+     * @param priority: the level
+     * @param depth: the depth of its list after the add
+     */
+    void added( const unsigned& priority , const unsigned& depth )
+    {
+        LevelStats& stats = this -> level( priority ) ;
+        LevelStats::bump( stats . depth[ depth ? 32 - __builtin_clz( depth ) : 0 ] ) ;
+        LevelStats::bump( stats . adds ) ;
+    }
+
+    /**
+     * @brief Record a dispatch from a level.
+     * @param priority: the level
+     * @param wait: how long the PCB waited in ns
+     */
+    void dispatched( const unsigned& priority , const uint64_t& wait )
+    {
+        LevelStats& stats = this -> level( priority ) ;
+        stats . wait . record( wait ) ;
+        LevelStats::bump( stats . dispatches ) ;
+    }
+
+    /**
+     * @brief Copy the statistics. Safe from any thread while the queue is in
+     * use; counters updated during the copy may or may not be included.
+     * @return ReadyQueueStatsSnapshot: the copy
+     */
+    ReadyQueueStatsSnapshot snapshot() const
+    {
+        ReadyQueueStatsSnapshot copy ;
+        for ( unsigned p = 0 ; p < LEVELS ; ++p )
+        {
+            const LevelStats* stats = this -> levels[ p ] . load( std::memory_order_acquire ) ;
+            if ( stats == nullptr )
+                continue ;
+            LevelStatsSnapshot level ;
+            level . priority = p ;
+            level . adds = stats -> adds . load( std::memory_order_relaxed ) ;
+            level . dispatches = stats -> dispatches . load( std::memory_order_relaxed ) ;
+            for ( const std::atomic<uint64_t>& c : stats -> wait . counts )
+                level . wait_counts . push_back( c . load( std::memory_order_relaxed ) ) ;
+            for ( const std::atomic<uint64_t>& c : stats -> depth )
+                level . depth_counts . push_back( c . load( std::memory_order_relaxed ) ) ;
+            copy . levels . push_back( level ) ;
+        }
+        return copy ;
+    }
+} ;
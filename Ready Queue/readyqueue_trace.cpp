@@ -0,0 +1,164 @@
+/**
+ * Assignment 1: priority queue of processes
+ * @file readyqueue_trace.cpp
+ * @author Corey Talbert
+ * @brief This is the implementation file for Trace and LatencyHistogram.
+ * @date 09-19-2022
+ */
+
+#include <cstdio>
+#include <cstring>
+#include "readyqueue_trace.h"
+
+/**
+ * @brief The magic number at the start of a trace file.
+ */
+static const char TRACE_MAGIC[ 4 ] = { 'R' , 'Q' , 'T' , '2' } ;
+
+/**
+ * @brief The size of the magic number, levels and record count.
+ */
+static const long TRACE_HEADER_SIZE = 12 ;
+
+/**
+ * @brief Append an operation.
+ * @param op: the kind of operation
+ * @param id: the PCB operated on or returned
+ * @param priority: the priority, if any
+ * @param result: the result, if any
+ */
+void Trace::append( const TraceOp& op , const uint32_t& id ,
+                    const unsigned& priority , const bool& result )
+{
+    this -> records . push_back( TraceRecord{ id , uint16_t( priority ) , uint8_t( op ) , uint8_t( result ) } ) ;
+}
+
+/**
+ * @brief Get the largest PCB ID in the trace.
+ * @return uint32_t: the largest ID, or 0 if there is none
+ */
+uint32_t Trace::maxID() const
+{
+    uint32_t max_id = 0 ;
+    for ( const TraceRecord& r : this -> records )
+        if ( r . id != TraceRecord::NO_PCB and r . id > max_id )
+            max_id = r . id ;
+    return max_id ;
+}
+
+/**
+ * @brief Write the trace to a file.
+ * @param path: the file name
+ * @return bool: true if the whole trace was written
+ */
+bool Trace::save( const char* path ) const
+{
+    FILE* file = fopen( path , "wb" ) ;
+    if ( file == NULL )
+        return false ;
+    uint32_t count = this -> records . size() ;
+    bool ok = fwrite( TRACE_MAGIC , sizeof( TRACE_MAGIC ) , 1 , file ) == 1
+        and fwrite( &this -> levels , sizeof( this -> levels ) , 1 , file ) == 1
+        and fwrite( &count , sizeof( count ) , 1 , file ) == 1
+        and fwrite( this -> records . data() , sizeof( TraceRecord ) , count , file ) == count ;
+    return fclose( file ) == 0 and ok ;
+}
+
+/**
+ * @brief Replace the trace with one read from a file. The file must be
+ * exactly as long as its header says, and every record must be a known
+ * operation with an ID below TRACE_MAX_IDS and a priority below levels.
+ * @param path: the file name
+ * @return bool: true if a whole, valid trace was read; otherwise the
+ * trace is left empty
+ */
+bool Trace::load( const char* path )
+{
+    this -> records . clear() ;
+    FILE* file = fopen( path , "rb" ) ;
+    if ( file == NULL )
+        return false ;
+    char magic[ 4 ] ;
+    uint32_t count = 0 ;
+    bool ok = fread( magic , sizeof( magic ) , 1 , file ) == 1
+        and memcmp( magic , TRACE_MAGIC , sizeof( magic ) ) == 0
+        and fread( &this -> levels , sizeof( this -> levels ) , 1 , file ) == 1
+        and fread( &count , sizeof( count ) , 1 , file ) == 1 ;
+    // The count is checked against the file's size before anything is
+    // allocated for it, so a truncated or corrupt header is caught.
+    if ( ok )
+        ok = fseek( file , 0 , SEEK_END ) == 0
+            and ftell( file ) == TRACE_HEADER_SIZE + ( long ) count * ( long ) sizeof( TraceRecord )
+            and fseek( file , TRACE_HEADER_SIZE , SEEK_SET ) == 0 ;
+    if ( ok )
+    {
+        this -> records . resize( count ) ;
+        ok = fread( this -> records . data() , sizeof( TraceRecord ) , count , file ) == count ;
+    }
+    fclose( file ) ;
+    for ( unsigned long i = 0 ; ok and i < this -> records . size() ; ++i )
+        ok = this -> valid( this -> records[ i ] ) ;
+    if ( not ok )
+        this -> records . clear() ;
+    return ok ;
+}
+
+/**
+ * @brief Check that a record could have been traced from a queue of
+ * levels priority levels.
+ * @param r: the record
+ * @return bool: true if the record is valid
+ */
+bool Trace::valid( const TraceRecord& r ) const
+{
+    if ( r . op >= TRACE_OPS )
+        return false ;
+    // Only a REMOVE from an empty queue has no PCB.
+    if ( r . id == TraceRecord::NO_PCB )
+        return TraceOp( r . op ) == TraceOp::REMOVE ;
+    if ( r . id >= TRACE_MAX_IDS )
+        return false ;
+    bool has_priority = TraceOp( r . op ) == TraceOp::ADD or TraceOp( r . op ) == TraceOp::CHANGE ;
+    return not has_priority or r . priority < this -> levels ;
+}
+
+/**
+ * @brief Get an upper bound of a percentile, to the bucket.
+ * @param fraction: the percentile as a fraction, e.g. 0.99
+ * @return uint64_t: the upper edge in ns of the bucket holding it
+ */
+uint64_t LatencyHistogram::percentile( const double& fraction ) const
+{
+    uint64_t rank = fraction * this -> count ;
+    uint64_t seen = 0 ;
+    for ( unsigned b = 0 ; b < 65 ; ++b )
+    {
+        seen += this -> buckets[ b ] ;
+        if ( seen > rank )
+            return b == 0 ? 0 : b == 64 ? this -> max : ( uint64_t( 1 ) << b ) - 1 ;
+    }
+    return this -> max ;
+}
+
+/**
+ * @brief Print a one-line summary and the non-empty buckets.
+ * @param name: the name of the operation
+ */
+void LatencyHistogram::display( const char* name ) const
+{
+    if ( this -> count == 0 )
+        return ;
+    printf( "%-10s count %lu  mean %.1f ns  p50 <%lu  p90 <%lu  p99 <%lu  p99.9 <%lu  max %lu\n" ,
+            name , ( unsigned long ) this -> count , ( double ) this -> total / this -> count ,
+            ( unsigned long ) this -> percentile( 0.5 ) , ( unsigned long ) this -> percentile( 0.9 ) ,
+            ( unsigned long ) this -> percentile( 0.99 ) , ( unsigned long ) this -> percentile( 0.999 ) ,
+            ( unsigned long ) this -> max ) ;
+    for ( unsigned b = 0 ; b < 65 ; ++b )
+    {
+        if ( this -> buckets[ b ] == 0 )
+            continue ;
+        uint64_t low = b == 0 ? 0 : uint64_t( 1 ) << ( b - 1 ) ;
+        printf( "    %10lu ns  %12lu  %6.2f%%\n" , ( unsigned long ) low ,
+                ( unsigned long ) this -> buckets[ b ] , 100.0 * this -> buckets[ b ] / this -> count ) ;
+    }
+}
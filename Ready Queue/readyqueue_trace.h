@@ -0,0 +1,253 @@
+/**
+ * Assignment 1: priority queue of processes
+ * @file readyqueue_trace.h
+ * @author Corey Talbert
+ * @brief Recording and replaying the operations done on a ReadyQueue. A
+ * TracingReadyQueue logs every operation and its result into a Trace, which
+ * is saved as a compact binary file of 8-byte records. Replaying a trace
+ * repeats exactly the same operations, in order, against any queue, and
+ * LatencyHistogram collects how long each kind of operation took.
+ * @version 0.1
+ * @date 09-19-2022
+ */
+
+#pragma once
+#include <cstdint>
+#include <vector>
+#include "readyqueue.h"
+
+/**
+ * @brief The kinds of traced operation.
+ * ADD: addPCB. REMOVE: removePCB. CHANGE: changePriority. REMOVE_ID: remove.
+ */
+enum class TraceOp : uint8_t { ADD, REMOVE, CHANGE, REMOVE_ID };
+
+/**
+ * @brief The number of kinds of traced operation.
+ */
+const unsigned TRACE_OPS = 4 ;
+
+/**
+ * @brief One traced operation.
+ */
+struct TraceRecord
+{
+    // The PCB operated on, or the one removePCB returned; NO_PCB if none.
+    uint32_t id ;
+    // The priority of an ADD, or the new priority of a CHANGE.
+    uint16_t priority ;
+    // The TraceOp.
+    uint8_t op ;
+    // Whether a CHANGE or REMOVE_ID found the PCB queued.
+    uint8_t result ;
+
+    /**
+     * @brief The id of a REMOVE from an empty queue.
+     */
+    static const uint32_t NO_PCB = UINT32_MAX ;
+} ;
+
+static_assert( sizeof( TraceRecord ) == 8 , "TraceRecord must stay at 8 bytes" ) ;
+
+/**
+ * @brief PCB IDs in a trace must be below this, so replaying a trace never
+ * allocates more than this many PCBs.
+ */
+const uint32_t TRACE_MAX_IDS = 1u << 24 ;
+
+/**
+ * @brief A sequence of traced operations. On disk it is a 4-byte magic
+ * number, the 4-byte number of priority levels of the traced queue, a
+ * 4-byte record count and the records, all in host byte order.
+ */
+class Trace
+{
+public:
+    /**
+     * @brief The number of priority levels of the traced queue. Every
+     * priority in the trace is below it.
+     */
+    uint32_t levels = MAX_PRIORITY + 1 ;
+
+    /**
+     * @brief The operations, in the order they were done.
+     */
+    std::vector<TraceRecord> records ;
+
+    /**
+     * @brief Append an operation.
+     * @param op: the kind of operation
+     * @param id: the PCB operated on or returned
+     * @param priority: the priority, if any
+     * @param result: the result, if any
+     */
+    void append( const TraceOp& op , const uint32_t& id ,
+                 const unsigned& priority = 0 , const bool& result = false ) ;
+
+    /**
+     * @brief Get the largest PCB ID in the trace.
+     * @return uint32_t: the largest ID, or 0 if there is none
+     */
+    uint32_t maxID() const ;
+
+    /**
+     * @brief Write the trace to a file.
+     * @param path: the file name
+     * @return bool: true if the whole trace was written
+     */
+    bool save( const char* path ) const ;
+
+    /**
+     * @brief Replace the trace with one read from a file. The file must be
+     * exactly as long as its header says, and every record must be a known
+     * operation with an ID below TRACE_MAX_IDS and a priority below levels.
+     * @param path: the file name
+     * @return bool: true if a whole, valid trace was read; otherwise the
+     * trace is left empty
+     */
+    bool load( const char* path ) ;
+
+    /**
+     * @brief Check that a record could have been traced from a queue of
+     * levels priority levels.
+     * @param r: the record
+     * @return bool: true if the record is valid
+     */
+    bool valid( const TraceRecord& r ) const ;
+} ;
+
+/**
+ * @brief A ReadyQueue that records each operation on it into a Trace. PCBs
+ * are identified in the trace by their IDs.
+ */
+template <unsigned LEVELS = MAX_PRIORITY + 1>
+class TracingReadyQueue
+{
+private:
+    /**
+     * @brief The queue operated on.
+     */
+    ReadyQueue<LEVELS> queue ;
+
+    /**
+     * @brief Where the operations are recorded.
+     */
+    Trace& trace ;
+
+public:
+    /**
+     * @brief Construct an empty queue recording into a trace. The trace
+     * takes the queue's number of levels.
+     * @param trace: the trace, which must outlive the queue
+     */
+    TracingReadyQueue( Trace& trace ) : trace( trace ) 
+    {
+        this -> trace . levels = LEVELS ;
+    }
+
+    /**
+     * @brief Add a PCB to the queue and record it. A PCB the queue rejects
+     * is not recorded.
+     * @param pcbPtr: the pointer to the PCB to be added
+     * @return bool: true if the PCB was added, false if it was already queued
+     */
+    bool addPCB( PCB* pcbPtr )
+    {
+        if ( not this -> queue . addPCB( pcbPtr ) )
+            return false ;
+        this -> trace . append( TraceOp::ADD , pcbPtr -> getID() , pcbPtr -> getPriority() ) ;
+        return true ;
+    }
+
+    /**
+     * @brief Remove the PCB with the highest priority and record which one.
+     * @return PCB*: the pointer to the PCB with the highest priority
+     */
+    PCB* removePCB()
+    {
+        PCB* pcbPtr = this -> queue . removePCB() ;
+        this -> trace . append( TraceOp::REMOVE , pcbPtr ? pcbPtr -> getID() : TraceRecord::NO_PCB ) ;
+        return pcbPtr ;
+    }
+
+    /**
+     * @brief Change the priority of a PCB and record it.
+     * @param pcbPtr: the pointer to the PCB
+     * @param priority: the new priority
+     * @return bool: true if the PCB was queued
+     */
+    bool changePriority( PCB* pcbPtr , const unsigned& priority )
+    {
+        bool queued = this -> queue . changePriority( pcbPtr , priority ) ;
+        this -> trace . append( TraceOp::CHANGE , pcbPtr -> getID() , priority , queued ) ;
+        return queued ;
+    }
+
+    /**
+     * @brief Remove a PCB from anywhere in the queue and record it.
+     * @param pcbPtr: the pointer to the PCB to be removed
+     * @return bool: true if the PCB was removed
+     */
+    bool remove( PCB* pcbPtr )
+    {
+        bool removed = this -> queue . remove( pcbPtr ) ;
+        this -> trace . append( TraceOp::REMOVE_ID , pcbPtr -> getID() , 0 , removed ) ;
+        return removed ;
+    }
+
+    /**
+     * @brief Returns the number of elements in the queue.
+     * @return int: the number of PCBs in the queue
+     */
+    int size() { return this -> queue . size() ; }
+} ;
+
+/**
+ * @brief A histogram of latencies in power-of-two nanosecond buckets.
+ */
+class LatencyHistogram
+{
+private:
+    /**
+     * @brief Bucket b counts the latencies in [ 2^(b-1), 2^b ) ns; bucket 0
+     * counts latencies of 0 ns.
+     */
+    uint64_t buckets[ 65 ] = {} ;
+
+    uint64_t count = 0 ;
+    uint64_t total = 0 ;
+    uint64_t max = 0 ;
+
+public:
+    /**
+     * @brief Count one latency.
+     * @param ns: the latency in nanoseconds
+     */
+    void record( const uint64_t& ns )
+    {
+        ++ this -> buckets[ ns ? 64 - __builtin_clzll( ns ) : 0 ] ;
+        ++ this -> count ;
+        this -> total += ns ;
+        if ( ns > this -> max )
+            this -> max = ns ;
+    }
+
+    /**
+     * @brief Get the number of latencies counted.
+     * @return uint64_t: the count
+     */
+    uint64_t getCount() const { return this -> count ; }
+
+    /**
+     * @brief Get an upper bound of a percentile, to the bucket.
+     * @param fraction: the percentile as a fraction, e.g. 0.99
+     * @return uint64_t: the upper edge in ns of the bucket holding it
+     */
+    uint64_t percentile( const double& fraction ) const ;
+
+    /**
+     * @brief Print a one-line summary and the non-empty buckets.
+     * @param name: the name of the operation
+     */
+    void display( const char* name ) const ;
+} ;
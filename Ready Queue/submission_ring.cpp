@@ -0,0 +1,97 @@
+/**
+ * Assignment 1: priority queue of processes
+ * @file submission_ring.cpp
+ * @author Corey Talbert
+ * @brief Implementation of submission_ring.h as a ring of sequenced slots.
+ * @date 09-19-2022
+ */
+#include "submission_ring.h"
+
+/**
+ * @brief Construct an empty ring.
+ * @param capacity: the number of PCBs the ring can hold, rounded up to a
+ * power of two
+ */
+SubmissionRing::SubmissionRing( const unsigned& capacity )
+    : tail( 0 ) , head( 0 )
+{
+    uint64_t size = 1 ;
+    while ( size < capacity )
+        size *= 2 ;
+    this -> mask = size - 1 ;
+    this -> slots = new Slot[ size ] ;
+    // Slot i is first ready for the producer of position i.
+    for ( uint64_t i = 0 ; i < size ; ++i )
+        this -> slots[ i ] . sequence . store( i , std::memory_order_relaxed ) ;
+}
+
+/**
+ * @brief Destructor. PCBs still in the ring are not owned and are left
+ * alone.
+ */
+SubmissionRing::~SubmissionRing()
+{
+    delete[] this -> slots ;
+}
+
+/**
+ * @brief Push a PCB. Safe from any number of threads at once.
+ * @param pcbPtr: the pointer to the PCB
+ * @return bool: true if the PCB was pushed, false if the ring was full
+ */
+bool SubmissionRing::push( PCB* pcbPtr )
+{
+    uint64_t position = this -> tail . load( std::memory_order_relaxed ) ;
+    for ( ;; )
+    {
+        Slot& slot = this -> slots[ position & this -> mask ] ;
+        uint64_t sequence = slot . sequence . load( std::memory_order_acquire ) ;
+        int64_t turn = int64_t( sequence ) - int64_t( position ) ;
+        if ( turn == 0 )
+        {
+            // The slot is free for this position; claim the position. On
+            // failure position is reloaded and the loop tries again.
+            if ( this -> tail . compare_exchange_weak( position , position + 1 ,
+                                                       std::memory_order_relaxed ) )
+            {
+                slot . pcb = pcbPtr ;
+                // Hand the slot to the consumer.
+                slot . sequence . store( position + 1 , std::memory_order_release ) ;
+                return true ;
+            }
+        }
+        else if ( turn < 0 )
+            // The slot still holds the PCB from one lap ago: the ring is full.
+            return false ;
+        else
+            // Another producer claimed this position first.
+            position = this -> tail . load( std::memory_order_relaxed ) ;
+    }
+}
+
+/**
+ * @brief Pop the oldest PCB. Only the consumer thread may call this.
+ * @return PCB*: the PCB, or nullptr if the ring is empty
+ */
+PCB* SubmissionRing::pop()
+{
+    Slot& slot = this -> slots[ this -> head & this -> mask ] ;
+    // Until the producer publishes, the slot's sequence is still head: empty,
+    // or claimed but not yet filled.
+    if ( slot . sequence . load( std::memory_order_acquire ) != this -> head + 1 )
+        return nullptr ;
+    PCB* pcbPtr = slot . pcb ;
+    // Give the slot back to producers for the next lap.
+    slot . sequence . store( this -> head + this -> mask + 1 , std::memory_order_release ) ;
+    ++ this -> head ;
+    return pcbPtr ;
+}
+
+/**
+ * @brief Get the number of PCBs the ring can hold.
+ * @return unsigned: the capacity
+ */
+unsigned SubmissionRing::capacity() const
+{
+    return this -> mask + 1 ;
+}
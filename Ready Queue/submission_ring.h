@@ -0,0 +1,127 @@
+/**
+ * Assignment 1: priority queue of processes
+ * @file submission_ring.h
+ * @author Corey Talbert
+ * @brief SubmissionRing is a bounded, lock-free, multi-producer
+ * single-consumer ring of PCB pointers. Threads that wake processes push
+ * them here without touching the ReadyQueue; the one scheduler thread that
+ * owns the ReadyQueue drains the ring into it in batches.
+ * @version 0.1
+ * @date 09-19-2022
+ */
+
+#pragma once
+#include <atomic>
+#include <cstdint>
+#include "readyqueue.h"
+
+/**
+ * @brief A bounded MPSC ring of PCB pointers. Each slot carries a sequence
+ * number that says whose turn it is: a producer may fill slot i % capacity
+ * when its sequence is i, and the consumer may empty it when its sequence is
+ * i + 1. Producers claim positions with a compare-and-swap on the tail; the
+ * consumer alone moves the head, so popping needs no atomic read-modify-write.
+ */
+class SubmissionRing
+{
+private:
+    /**
+     * @brief One slot of the ring.
+     */
+    struct Slot
+    {
+        std::atomic<uint64_t> sequence ;
+        PCB* pcb ;
+    } ;
+
+    /**
+     * @brief The number of PCBs pulled from the ring per addPCBs call when
+     * draining.
+     */
+    static const unsigned DRAIN_BATCH = 64 ;
+
+    /**
+     * @brief The slots, capacity of them.
+     */
+    Slot* slots ;
+
+    /**
+     * @brief capacity - 1, capacity being a power of two.
+     */
+    uint64_t mask ;
+
+    /**
+     * @brief The next position producers will claim. On its own cache line,
+     * away from head, so producers and the consumer do not share a line.
+     */
+    alignas( 64 ) std::atomic<uint64_t> tail ;
+
+    /**
+     * @brief The next position the consumer will take. Only the consumer
+     * writes it.
+     */
+    alignas( 64 ) uint64_t head ;
+
+public:
+    /**
+     * @brief Construct an empty ring.
+     * @param capacity: the number of PCBs the ring can hold, rounded up to a
+     * power of two
+     */
+    SubmissionRing( const unsigned& capacity = 1024 ) ;
+
+    /**
+     * @brief Destructor. PCBs still in the ring are not owned and are left
+     * alone.
+     */
+    ~SubmissionRing() ;
+
+    SubmissionRing( const SubmissionRing& ) = delete ;
+    SubmissionRing& operator=( const SubmissionRing& ) = delete ;
+
+    /**
+     * @brief Push a PCB. Safe from any number of threads at once.
+     * @param pcbPtr: the pointer to the PCB
+     * @return bool: true if the PCB was pushed, false if the ring was full
+     */
+    bool push( PCB* pcbPtr ) ;
+
+    /**
+     * @brief Pop the oldest PCB. Only the consumer thread may call this.
+     * @return PCB*: the PCB, or nullptr if the ring is empty
+     */
+    PCB* pop() ;
+
+    /**
+     * @brief Move up to max PCBs from the ring into a ReadyQueue, in batches
+     * of up to DRAIN_BATCH through ReadyQueue::addPCBs. Only the consumer
+     * thread may call this, and it must be the only user of the queue.
+     * @param queue: the queue
+     * @param max: the largest number of PCBs to move
+     * @return unsigned: the number of PCBs moved
+     */
+    template <unsigned LEVELS>
+    unsigned drainInto( ReadyQueue<LEVELS>& queue , const unsigned& max = UINT32_MAX )
+    {
+        PCB* batch[ DRAIN_BATCH ] ;
+        unsigned moved = 0 ;
+        while ( moved < max )
+        {
+            unsigned n = 0 ;
+            while ( n < DRAIN_BATCH and moved + n < max
+                and ( batch[ n ] = this -> pop() ) != nullptr )
+                ++ n ;
+            queue . addPCBs( batch , batch + n ) ;
+            moved += n ;
+            if ( n < DRAIN_BATCH )
+                break ;
+        }
+        return moved ;
+    }
+
+    /**
+     * @brief Get the number of PCBs the ring can hold.
+     * @return unsigned: the capacity
+     */
+    unsigned capacity() const ;
+} ; // End of class SubmissionRing
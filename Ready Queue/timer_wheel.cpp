@@ -0,0 +1,236 @@
+/**
+ * Assignment 1: priority queue of processes
+ * @file timer_wheel.cpp
+ * @author Corey Talbert
+ * @brief Implementation of timer_wheel.h as a four-level cascading wheel.
+ * @date 09-19-2022
+ */
+#include "timer_wheel.h"
+
+// Taken by reference in cascade, so it needs a definition.
+const unsigned TimerWheel::OVERFLOW_SLOT ;
+
+/**
+ * @brief Construct an empty wheel.
+ * @param now: the current tick
+ */
+TimerWheel::TimerWheel( const uint64_t& now )
+    : base( now )
+{}
+
+/**
+ * @brief Destructor. The timers are freed; PCBs still waiting are not
+ * owned and are left alone.
+ */
+TimerWheel::~TimerWheel()
+{
+    for ( Timer* chunk : this -> chunks )
+        delete[] chunk ;
+}
+
+/**
+ * @brief Take a free timer, allocating a chunk if none is free.
+ * @return Timer*: the timer
+ */
+TimerWheel::Timer* TimerWheel::acquire()
+{
+    if ( this -> free_timers == nullptr )
+    {
+        Timer* chunk = new Timer[ CHUNK ] ;
+        this -> chunks . push_back( chunk ) ;
+        // Linked in address order so consecutive acquires walk the chunk.
+        for ( unsigned i = CHUNK ; i > 0 ; --i )
+        {
+            chunk[ i - 1 ] . next = this -> free_timers ;
+            this -> free_timers = &chunk[ i - 1 ] ;
+        }
+        this -> pool_stats . capacity += CHUNK ;
+        ++ this -> pool_stats . chunks ;
+    }
+    Timer* timer = this -> free_timers ;
+    this -> free_timers = timer -> next ;
+    if ( ++ this -> pool_stats . in_use > this -> pool_stats . high_water )
+        this -> pool_stats . high_water = this -> pool_stats . in_use ;
+    return timer ;
+}
+
+/**
+ * @brief Give a timer back, ending its serial so handles to it go stale.
+ * @param timer: the timer
+ */
+void TimerWheel::release( Timer* timer )
+{
+    timer -> serial = 0 ;
+    timer -> pcb = nullptr ;
+    timer -> prev = nullptr ;
+    timer -> next = this -> free_timers ;
+    this -> free_timers = timer ;
+    -- this -> pool_stats . in_use ;
+}
+
+/**
+ * @brief Link a timer into the slot for its expiry, relative to base.
+ * @param timer: the timer
+ */
+void TimerWheel::insert( Timer* timer )
+{
+    unsigned slot ;
+    if ( timer -> expires < this -> base )
+        // Already due: the slot processed next.
+        slot = this -> base & ( SLOTS - 1 ) ;
+    else
+    {
+        // The lowest level whose range covers the delay, at the slot of the
+        // expiry's digit for that level.
+        uint64_t delay = timer -> expires - this -> base ;
+        unsigned level = 0 ;
+        while ( level < LEVELS and delay >> ( SLOT_BITS * ( level + 1 ) ) )
+            ++ level ;
+        slot = level == LEVELS
+            ? OVERFLOW_SLOT
+            : level * SLOTS + ( ( timer -> expires >> ( SLOT_BITS * level ) ) & ( SLOTS - 1 ) ) ;
+    }
+    timer -> slot = slot ;
+    timer -> prev = nullptr ;
+    timer -> next = this -> slots[ slot ] ;
+    if ( timer -> next )
+        timer -> next -> prev = timer ;
+    this -> slots[ slot ] = timer ;
+}
+
+/**
+ * @brief Unlink a timer from its slot.
+ * @param timer: the timer
+ */
+void TimerWheel::unlink( Timer* timer )
+{
+    if ( timer -> prev )
+        timer -> prev -> next = timer -> next ;
+    else
+        this -> slots[ timer -> slot ] = timer -> next ;
+    if ( timer -> next )
+        timer -> next -> prev = timer -> prev ;
+}
+
+/**
+ * @brief Reinsert every timer of one slot, moving each to a lower level.
+ * @param slot: the slot
+ */
+void TimerWheel::cascade( const unsigned& slot )
+{
+    Timer* timer = this -> slots[ slot ] ;
+    this -> slots[ slot ] = nullptr ;
+    while ( timer )
+    {
+        Timer* next = timer -> next ;
+        this -> insert( timer ) ;
+        timer = next ;
+    }
+}
+
+/**
+ * @brief Process tick base: cascade if a level wrapped, collect the PCBs
+ * of the expiring slot into expired, and advance base.
+ */
+void TimerWheel::step()
+{
+    // When the lowest level wraps, the next slot of the level above is due
+    // to be spread over the levels below, and so on up while levels wrap.
+    if ( ( this -> base & ( SLOTS - 1 ) ) == 0 )
+    {
+        for ( unsigned l = 1 ; l < LEVELS ; ++l )
+        {
+            unsigned index = ( this -> base >> ( SLOT_BITS * l ) ) & ( SLOTS - 1 ) ;
+            this -> cascade( l * SLOTS + index ) ;
+            if ( index != 0 )
+                break ;
+            // The top level wrapped too: the overflow list may now be in range.
+            if ( l + 1 == LEVELS )
+                this -> cascade( OVERFLOW_SLOT ) ;
+        }
+    }
+
+    this -> expired . clear() ;
+    unsigned slot = this -> base & ( SLOTS - 1 ) ;
+    Timer* timer = this -> slots[ slot ] ;
+    this -> slots[ slot ] = nullptr ;
+    while ( timer )
+    {
+        Timer* next = timer -> next ;
+        this -> expired . push_back( timer -> pcb ) ;
+        this -> release( timer ) ;
+        -- this -> count ;
+        timer = next ;
+    }
+    ++ this -> base ;
+}
+
+/**
+ * @brief Put a PCB to sleep until a tick. The PCB becomes WAITING. A tick
+ * already past wakes it on the next tick.
+ * @param pcbPtr: the pointer to the PCB
+ * @param expires: the tick to wake it at
+ * @return TimerHandle: a handle for cancel
+ */
+TimerHandle TimerWheel::schedule( PCB* pcbPtr , const uint64_t& expires )
+{
+    pcbPtr -> setState( ProcState::WAITING ) ;
+    Timer* timer = this -> acquire() ;
+    timer -> pcb = pcbPtr ;
+    timer -> expires = expires ;
+    timer -> serial = this -> next_serial ++ ;
+    this -> insert( timer ) ;
+    ++ this -> count ;
+    TimerHandle handle ;
+    handle . timer = timer ;
+    handle . serial = timer -> serial ;
+    return handle ;
+}
+
+/**
+ * @brief Cancel a timer in O(1). The PCB is left WAITING, for the caller
+ * to deal with.
+ * @param handle: the handle from schedule
+ * @return PCB*: the PCB of the timer, or nullptr if it had already fired
+ * or been cancelled
+ */
+PCB* TimerWheel::cancel( const TimerHandle& handle )
+{
+    Timer* timer = static_cast<Timer*>( handle . timer ) ;
+    // Timers are never destroyed while the wheel lives, so a stale handle
+    // still points at a live timer, one with a different serial.
+    if ( timer == nullptr or timer -> serial != handle . serial )
+        return nullptr ;
+    PCB* pcbPtr = timer -> pcb ;
+    this -> unlink( timer ) ;
+    this -> release( timer ) ;
+    -- this -> count ;
+    return pcbPtr ;
+}
+
+/**
+ * @brief Get the next tick to be processed.
+ * @return uint64_t: the tick
+ */
+uint64_t TimerWheel::now() const
+{
+    return this -> base ;
+}
+
+/**
+ * @brief Get the number of PCBs waiting.
+ * @return unsigned: the number of scheduled timers
+ */
+unsigned TimerWheel::size() const
+{
+    return this -> count ;
+}
+
+/**
+ * @brief Get the usage statistics of the timer pool.
+ * @return NodePoolStats: capacity, timers in use, high-water mark and chunks
+ */
+NodePoolStats TimerWheel::getPoolStats() const
+{
+    return this -> pool_stats ;
+}
@@ -0,0 +1,250 @@
+/**
+ * Assignment 1: priority queue of processes
+ * @file timer_wheel.h
+ * @author Corey Talbert
+ * @brief TimerWheel holds PCBs in the WAITING state until a given tick and
+ * then moves them into a ReadyQueue. It is a hierarchical timing wheel: four
+ * levels of 64 slots, each level 64 times coarser than the one below, with
+ * timers cascading down a level as their time comes closer.
+ * @version 0.1
+ * @date 09-19-2022
+ */
+
+#pragma once
+#include <cstdint>
+#include <vector>
+#include "nodepool.h"
+#include "readyqueue.h"
+
+/**
+ * @brief A reference to a scheduled timer, used to cancel it. Stale handles,
+ * to timers that have fired or been cancelled, are recognised and ignored.
+ */
+struct TimerHandle
+{
+    // The timer.
+    void* timer = nullptr ;
+    // The serial number the timer had when it was scheduled.
+    uint64_t serial = 0 ;
+} ;
+
+/**
+ * @brief A hierarchical timing wheel of WAITING PCBs. Scheduling and
+ * cancelling are O(1). Each tick expires one slot of the lowest level; every
+ * 64 ticks one slot of the next level is redistributed into the levels
+ * below, and so on up, so each timer is moved at most once per level.
+ * Timers further out than the top level wait in an overflow list that is
+ * redistributed once per turn of the top level.
+ */
+class TimerWheel
+{
+private:
+    /**
+     * @brief A timer, linked into one slot while scheduled and into the
+     * free list otherwise.
+     */
+    struct Timer
+    {
+        Timer* next = nullptr ;
+        Timer* prev = nullptr ;
+        // The PCB to wake.
+        PCB* pcb = nullptr ;
+        // The tick at which the PCB is woken.
+        uint64_t expires = 0 ;
+        // Unique while scheduled and 0 once fired or cancelled.
+        uint64_t serial = 0 ;
+        // The slot holding the timer: level * SLOTS + index, or OVERFLOW_SLOT.
+        unsigned slot = 0 ;
+    } ;
+
+    /**
+     * @brief The number of timers allocated at a time.
+     */
+    static const unsigned CHUNK = 256 ;
+
+    /**
+     * @brief The number of slots per level, as a power of two.
+     */
+    static const unsigned SLOT_BITS = 6 ;
+    static const unsigned SLOTS = 1 << SLOT_BITS ;
+
+    /**
+     * @brief The number of levels.
+     */
+    static const unsigned LEVELS = 4 ;
+
+    /**
+     * @brief The slot number of the overflow list.
+     */
+    static const unsigned OVERFLOW_SLOT = LEVELS * SLOTS ;
+
+    /**
+     * @brief The head of each slot's list, then the overflow list.
+     */
+    Timer* slots[ LEVELS * SLOTS + 1 ] = {} ;
+
+    /**
+     * @brief Every chunk of CHUNK timers allocated. The timers are not
+     * pooled in a NodePool: it destroys what it takes back, and a stale
+     * handle would then read the serial of a dead timer, whose store of 0
+     * the compiler is free to drop. These timers live as long as the
+     * wheel, so a free one always reads serial 0.
+     */
+    std::vector<Timer*> chunks ;
+
+    /**
+     * @brief The first free timer, linked through next.
+     */
+    Timer* free_timers = nullptr ;
+
+    /**
+     * @brief The usage statistics of the timers, kept as a NodePool would.
+     */
+    NodePoolStats pool_stats ;
+
+    /**
+     * @brief The next tick to be processed. Every timer expiring before it
+     * has fired.
+     */
+    uint64_t base ;
+
+    /**
+     * @brief The serial number of the next timer.
+     */
+    uint64_t next_serial = 1 ;
+
+    /**
+     * @brief The number of scheduled timers.
+     */
+    unsigned count = 0 ;
+
+    /**
+     * @brief The PCBs expired by the current tick, reused between ticks.
+     */
+    std::vector<PCB*> expired ;
+
+    /**
+     * @brief Take a free timer, allocating a chunk if none is free.
+     * @return Timer*: the timer
+     */
+    Timer* acquire() ;
+
+    /**
+     * @brief Give a timer back, ending its serial so handles to it go stale.
+     * @param timer: the timer
+     */
+    void release( Timer* timer ) ;
+
+    /**
+     * @brief Link a timer into the slot for its expiry, relative to base.
+     * @param timer: the timer
+     */
+    void insert( Timer* timer ) ;
+
+    /**
+     * @brief Unlink a timer from its slot.
+     * @param timer: the timer
+     */
+    void unlink( Timer* timer ) ;
+
+    /**
+     * @brief Reinsert every timer of one slot, moving each to a lower level.
+     * @param slot: the slot
+     */
+    void cascade( const unsigned& slot ) ;
+
+    /**
+     * @brief Process tick base: cascade if a level wrapped, collect the PCBs
+     * of the expiring slot into expired, and advance base.
+     */
+    void step() ;
+
+public:
+    /**
+     * @brief Construct an empty wheel.
+     * @param now: the current tick
+     */
+    TimerWheel( const uint64_t& now = 0 ) ;
+
+    /**
+     * @brief Destructor. The timers are freed; PCBs still waiting are not
+     * owned and are left alone.
+     */
+    ~TimerWheel() ;
+
+    TimerWheel( const TimerWheel& ) = delete ;
+    TimerWheel& operator=( const TimerWheel& ) = delete ;
+
+    /**
+     * @brief Put a PCB to sleep until a tick. The PCB becomes WAITING. A tick
+     * already past wakes it on the next tick.
+     * @param pcbPtr: the pointer to the PCB
+     * @param expires: the tick to wake it at
+     * @return TimerHandle: a handle for cancel
+     */
+    TimerHandle schedule( PCB* pcbPtr , const uint64_t& expires ) ;
+
+    /**
+     * @brief Cancel a timer in O(1). The PCB is left WAITING, for the caller
+     * to deal with.
+     * @param handle: the handle from schedule
+     * @return PCB*: the PCB of the timer, or nullptr if it had already fired
+     * or been cancelled
+     */
+    PCB* cancel( const TimerHandle& handle ) ;
+
+    /**
+     * @brief Process every tick up to and including a tick, adding the PCBs
+     * that expire on each tick to a ReadyQueue with one addPCBs per tick.
+     * @param now: the tick to advance to
+     * @param queue: the queue to wake PCBs into
+     * @return unsigned: the number of PCBs woken
+     */
+    template <unsigned QUEUE_LEVELS>
+    unsigned advance( const uint64_t& now , ReadyQueue<QUEUE_LEVELS>& queue )
+    {
+        unsigned woken = 0 ;
+        while ( this -> base <= now )
+        {
+            // With nothing scheduled there is nothing to cascade or expire.
+            if ( this -> count == 0 )
+            {
+                this -> base = now + 1 ;
+                break ;
+            }
+            this -> step() ;
+            queue . addPCBs( this -> expired . begin() , this -> expired . end() ) ;
+            woken += this -> expired . size() ;
+        }
+        return woken ;
+    }
+
+    /**
+     * @brief Process the next tick.
+     * @param queue: the queue to wake PCBs into
+     * @return unsigned: the number of PCBs woken
+     */
+    template <unsigned QUEUE_LEVELS>
+    unsigned tick( ReadyQueue<QUEUE_LEVELS>& queue )
+    {
+        return this -> advance( this -> base , queue ) ;
+    }
+
+    /**
+     * @brief Get the next tick to be processed.
+     * @return uint64_t: the tick
+     */
+    uint64_t now() const ;
+
+    /**
+     * @brief Get the number of PCBs waiting.
+     * @return unsigned: the number of scheduled timers
+     */
+    unsigned size() const ;
+
+    /**
+     * @brief Get the usage statistics of the timer pool.
+     * @return NodePoolStats: capacity, timers in use, high-water mark and chunks
+     */
+    NodePoolStats getPoolStats() const ;
+} ; // End of class TimerWheel
@@ -0,0 +1,260 @@
+/**
+ * Assignment 1: priority queue of processes
+ * @file trace_tool.cpp
+ * @author Corey Talbert
+ * @brief Records ReadyQueue operation traces and replays them.
+ *
+ * Usage:
+ *   trace_tool record <file> [ops] [population] [seed]
+ *       Run a synthetic dispatch load against a TracingReadyQueue and save
+ *       the trace. Production code records the same way by using a
+ *       TracingReadyQueue in place of its ReadyQueue.
+ *   trace_tool replay <file> [bucket|compact]
+ *       Replay a trace at full speed against ReadyQueue (bucket, the default)
+ *       or CompactReadyQueue, check every result against the recorded one,
+ *       then replay it again timing each operation and print a latency
+ *       histogram per kind of operation. Built with READYQUEUE_STATS, the
+ *       bucket replay also prints the queue's wait and depth statistics.
+ * @version 0.1
+ * @date 09-19-2022
+ */
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <vector>
+#include "compact_readyqueue.h"
+#include "readyqueue_trace.h"
+using namespace std::chrono ;
+
+/**
+ * @brief Replays onto a ReadyQueue of PCB objects, one per traced ID.
+ */
+struct BucketReplay
+{
+    std::vector<PCB> pcbs ;
+    ReadyQueue<> queue ;
+
+    BucketReplay( uint32_t ids ) : pcbs( ids )
+    {
+        for ( uint32_t i = 0 ; i < ids ; ++i )
+            pcbs[ i ] = PCB( i ) ;
+    }
+
+    void add( uint32_t id , unsigned priority )
+    {
+        pcbs[ id ].setPriority( priority ) ;
+        queue.addPCB( &pcbs[ id ] ) ;
+    }
+
+    uint32_t remove()
+    {
+        PCB* pcb = queue.removePCB() ;
+        return pcb ? pcb -> getID() : TraceRecord::NO_PCB ;
+    }
+
+    bool change( uint32_t id , unsigned priority ) { return queue.changePriority( &pcbs[ id ] , priority ) ; }
+    bool removeID( uint32_t id ) { return queue.remove( &pcbs[ id ] ) ; }
+} ;
+
+/**
+ * @brief Replays onto a CompactReadyQueue whose table IDs match the traced IDs.
+ */
+struct CompactReplay
+{
+    CompactPCBTable table ;
+    CompactReadyQueue<> queue ;
+
+    CompactReplay( uint32_t ids ) : table( ids ) , queue( table )
+    {
+        // A fresh table hands out IDs in order.
+        for ( uint32_t i = 0 ; i < ids ; ++i )
+            table.allocate() ;
+    }
+
+    void add( uint32_t id , unsigned priority )
+    {
+        table.getHot( id ).priority = priority ;
+        queue.addPCB( id ) ;
+    }
+
+    uint32_t remove() { return queue.removePCB() ; }
+    bool change( uint32_t id , unsigned priority ) { return queue.changePriority( id , priority ) ; }
+    bool removeID( uint32_t id ) { return queue.remove( id ) ; }
+} ;
+
+/**
+ * @brief Print the statistics of a replayed queue, if it keeps any.
+ */
+inline void displayStats( const BucketReplay & replay )
+{
+#ifdef READYQUEUE_STATS
+    replay.queue.getStats().display() ;
+    putchar( '\n' ) ;
+#else
+    ( void ) replay ;
+#endif
+}
+
+inline void displayStats( const CompactReplay & )
+{
+}
+
+/**
+ * @brief Do one traced operation.
+ * @return bool: true if the result matches the recorded one
+ */
+template <class Replay>
+inline bool replayOne( Replay & replay , const TraceRecord & r )
+{
+    switch ( TraceOp( r.op ) )
+    {
+        case TraceOp::ADD:
+            replay.add( r.id , r.priority ) ;
+            return true ;
+        case TraceOp::REMOVE:
+            return replay.remove() == r.id ;
+        case TraceOp::CHANGE:
+            return replay.change( r.id , r.priority ) == bool( r.result ) ;
+        case TraceOp::REMOVE_ID:
+            return replay.removeID( r.id ) == bool( r.result ) ;
+    }
+    return false ;
+}
+
+/**
+ * @brief Replay a trace twice on fresh queues: once untimed at full speed,
+ * checking the results, and once timing every operation.
+ * @return int: the exit status, non-zero if any result differed
+ */
+template <class Replay>
+int replay( const Trace & trace )
+{
+    const std::vector<TraceRecord> & records = trace.records ;
+    uint32_t ids = trace.maxID() + 1 ;
+
+    Replay* full = new Replay( ids ) ;
+    unsigned long mismatches = 0 ;
+    high_resolution_clock::time_point start = high_resolution_clock::now() ;
+    for ( const TraceRecord & r : records )
+        mismatches += not replayOne( *full , r ) ;
+    high_resolution_clock::time_point end = high_resolution_clock::now() ;
+    displayStats( *full ) ;
+    delete full ;
+    double ns = duration<double, std::nano>( end - start ).count() ;
+    printf( "%zu operations in %.3f ms, %.2f ns/op, %lu mismatches\n" ,
+            records.size() , ns / 1e6 , records.empty() ? 0.0 : ns / records.size() , mismatches ) ;
+
+    // Each timed operation also pays for one clock read; its cost is shown
+    // so it can be discounted.
+    LatencyHistogram clock_cost ;
+    for ( unsigned i = 0 ; i < 1000 ; ++i )
+    {
+        steady_clock::time_point t0 = steady_clock::now() ;
+        steady_clock::time_point t1 = steady_clock::now() ;
+        clock_cost.record( duration_cast<nanoseconds>( t1 - t0 ).count() ) ;
+    }
+    printf( "clock read p50 <%lu ns, included in the latencies below\n\n" ,
+            ( unsigned long ) clock_cost.percentile( 0.5 ) ) ;
+
+    Replay* timed = new Replay( ids ) ;
+    LatencyHistogram histograms[ TRACE_OPS ] ;
+    for ( const TraceRecord & r : records )
+    {
+        steady_clock::time_point t0 = steady_clock::now() ;
+        replayOne( *timed , r ) ;
+        steady_clock::time_point t1 = steady_clock::now() ;
+        histograms[ r.op % TRACE_OPS ].record( duration_cast<nanoseconds>( t1 - t0 ).count() ) ;
+    }
+    delete timed ;
+    const char* names[ TRACE_OPS ] = { "add" , "remove" , "change" , "remove_id" } ;
+    for ( unsigned op = 0 ; op < TRACE_OPS ; ++op )
+        histograms[ op ].display( names[ op ] ) ;
+    return mismatches ? 2 : 0 ;
+}
+
+/**
+ * @brief Record a synthetic dispatch load: PCBs of a fixed population are
+ * admitted with random priorities, dispatched, reniced and killed.
+ */
+void record( Trace & trace , unsigned long ops , unsigned population )
+{
+    // The PCBs are declared first so they outlive the queue, which in
+    // intrusive builds unlinks the ones still queued when it is destroyed.
+    std::vector<PCB> pcbs( population ) ;
+    std::vector<bool> queued( population ) ;
+    TracingReadyQueue<> queue( trace ) ;
+    for ( unsigned i = 0 ; i < population ; ++i )
+        pcbs[ i ] = PCB( i ) ;
+    for ( unsigned long n = 0 ; n < ops ; ++n )
+    {
+        unsigned i = rand() % population ;
+        unsigned priority = MIN_PRIORITY + rand() % ( MAX_PRIORITY - MIN_PRIORITY + 1 ) ;
+        unsigned dice = rand() % 100 ;
+        if ( dice < 48 and not queued[ i ] )
+        {
+            pcbs[ i ].setPriority( priority ) ;
+            queue.addPCB( &pcbs[ i ] ) ;
+            queued[ i ] = true ;
+        }
+        else if ( dice < 94 )
+        {
+            PCB* pcb = queue.removePCB() ;
+            if ( pcb )
+                queued[ pcb -> getID() ] = false ;
+        }
+        else if ( dice < 97 )
+            queue.changePriority( &pcbs[ i ] , priority ) ;
+        else if ( queue.remove( &pcbs[ i ] ) )
+            queued[ i ] = false ;
+    }
+}
+
+int main( int argc , char * argv[] )
+{
+    if ( argc >= 3 and strcmp( argv[ 1 ] , "record" ) == 0 )
+    {
+        unsigned long ops = argc > 3 ? strtoul( argv[ 3 ] , NULL , 10 ) : 1000000 ;
+        unsigned population = argc > 4 ? atoi( argv[ 4 ] ) : 1000 ;
+        srand( argc > 5 ? atoi( argv[ 5 ] ) : 433 ) ;
+        if ( population == 0 )
+            population = 1 ;
+        Trace trace ;
+        record( trace , ops , population ) ;
+        if ( not trace.save( argv[ 2 ] ) )
+        {
+            perror( argv[ 2 ] ) ;
+            return 1 ;
+        }
+        printf( "recorded %zu operations to %s\n" , trace.records.size() , argv[ 2 ] ) ;
+        return 0 ;
+    }
+    if ( argc >= 3 and strcmp( argv[ 1 ] , "replay" ) == 0 )
+    {
+        Trace trace ;
+        if ( not trace.load( argv[ 2 ] ) )
+        {
+            fprintf( stderr , "%s: not a readable trace\n" , argv[ 2 ] ) ;
+            return 1 ;
+        }
+        // The replay queues have the default levels, so every priority of
+        // a trace from a queue with as many levels or fewer fits.
+        if ( trace.levels > MAX_PRIORITY + 1 )
+        {
+            fprintf( stderr , "%s: traced with %u priority levels, replay supports %u\n" ,
+                     argv[ 2 ] , trace.levels , MAX_PRIORITY + 1 ) ;
+            return 1 ;
+        }
+        const char* queue = argc > 3 ? argv[ 3 ] : "bucket" ;
+        if ( strcmp( queue , "bucket" ) == 0 )
+            return replay<BucketReplay>( trace ) ;
+        if ( strcmp( queue , "compact" ) == 0 )
+            return replay<CompactReplay>( trace ) ;
+        fprintf( stderr , "unknown queue %s\n" , queue ) ;
+        return 1 ;
+    }
+    fprintf( stderr , "usage: %s record <file> [ops] [population] [seed]\n"
+                      "       %s replay <file> [bucket|compact]\n" , argv[ 0 ] , argv[ 0 ] ) ;
+    return 1 ;
+}